@@ -0,0 +1,151 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <Objectively.h>
+#include <ObjectivelyMVC.h>
+
+/**
+ * @brief The count of rows, the count of Views per row, and the nesting depth of each.
+ */
+#define ROWS 200
+#define COLUMNS 10
+#define DEPTH 4
+
+/**
+ * @brief The count of frames to time.
+ */
+#define FRAMES 500
+
+/**
+ * @brief Creates a chain of nested Views of the given depth.
+ */
+static View *createChain(int depth) {
+
+	const SDL_Rect frame = MakeRect(0, 0, 16, 16);
+
+	View *view = $(alloc(View), initWithFrame, &frame);
+	assert(view);
+
+	if (depth > 1) {
+		View *child = createChain(depth - 1);
+
+		$(view, addSubview, child);
+		release(child);
+	}
+
+	return view;
+}
+
+/**
+ * @return The elapsed time since the given counter, in microseconds.
+ */
+static double elapsed(Uint64 start) {
+	return (SDL_GetPerformanceCounter() - start) * 1000000.0 / SDL_GetPerformanceFrequency();
+}
+
+/**
+ * @brief Times the per frame cost of drawing an unchanged View hierarchy.
+ */
+int main(int argc, char *argv[]) {
+
+	SDL_Init(SDL_INIT_VIDEO);
+
+	SDL_Window *window = SDL_CreateWindow(__FILE__,
+		SDL_WINDOWPOS_UNDEFINED,
+		SDL_WINDOWPOS_UNDEFINED,
+		1024,
+		768,
+		SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN
+	);
+
+	SDL_GLContext *context = SDL_GL_CreateContext(window);
+
+	Renderer *renderer = $(alloc(Renderer), init);
+	assert(renderer);
+
+	const SDL_Rect frame = MakeRect(0, 0, 1024, 768);
+
+	View *root = $(alloc(View), initWithFrame, &frame);
+	assert(root);
+
+	for (int i = 0; i < ROWS; i++) {
+
+		const SDL_Rect rowFrame = MakeRect(0, i * 4, 1024, 16);
+
+		View *row = $(alloc(View), initWithFrame, &rowFrame);
+		assert(row);
+
+		for (int j = 0; j < COLUMNS; j++) {
+			View *chain = createChain(DEPTH);
+			chain->frame.x = j * 20;
+
+			$(row, addSubview, chain);
+			release(chain);
+		}
+
+		$(root, addSubview, row);
+		release(row);
+	}
+
+	const int views = 1 + ROWS * (1 + COLUMNS * DEPTH);
+
+	double draw = 0.0, render = 0.0;
+
+	for (int i = 0; i < FRAMES; i++) {
+
+		$(renderer, beginFrame);
+
+		Uint64 start = SDL_GetPerformanceCounter();
+
+		$(root, layoutIfNeeded);
+		$(root, draw, renderer);
+
+		draw += elapsed(start);
+
+		start = SDL_GetPerformanceCounter();
+
+		$(renderer, render);
+
+		render += elapsed(start);
+
+		$(renderer, endFrame);
+	}
+
+	printf("%d views, %d frames\n", views, FRAMES);
+	printf("draw:   %8.1f us per frame\n", draw / FRAMES);
+	printf("render: %8.1f us per frame\n", render / FRAMES);
+
+	release(root);
+	release(renderer);
+
+	SDL_GL_DeleteContext(context);
+	SDL_DestroyWindow(window);
+
+	SDL_Quit();
+
+	return 0;
+}
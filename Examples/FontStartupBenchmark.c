@@ -0,0 +1,121 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively.h>
+#include <ObjectivelyMVC.h>
+
+/**
+ * @brief The font sizes and styles to resolve.
+ */
+static const int sizes[] = { 12, 14, 16, 24 };
+static const int styles[] = { 0, TTF_STYLE_BOLD, TTF_STYLE_ITALIC, TTF_STYLE_BOLD | TTF_STYLE_ITALIC };
+
+/**
+ * @brief Removes the font resolution cache, so that fonts must be matched by Fontconfig.
+ */
+static void removeResolutionCache(void) {
+
+	char *dir = SDL_GetPrefPath("ObjectivelyMVC", "ObjectivelyMVC");
+	if (dir) {
+		char path[4096];
+		snprintf(path, sizeof(path), "%s%s", dir, DEFAULT_FONT_RESOLUTION_CACHE);
+
+		remove(path);
+		SDL_free(dir);
+	}
+}
+
+/**
+ * @brief Times the resolution of each font size and style, in this process.
+ */
+static void timeFontResolution(const char *run) {
+
+	SDL_Init(SDL_INIT_VIDEO);
+
+	SDL_Window *window = SDL_CreateWindow(__FILE__,
+		SDL_WINDOWPOS_UNDEFINED,
+		SDL_WINDOWPOS_UNDEFINED,
+		1024,
+		768,
+		SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN
+	);
+
+	SDL_GLContext *context = SDL_GL_CreateContext(window);
+
+	const Uint64 start = SDL_GetPerformanceCounter();
+
+	for (size_t i = 0; i < lengthof(sizes); i++) {
+		for (size_t j = 0; j < lengthof(styles); j++) {
+
+			Font *font = $$(Font, cachedFontWithAttributes, DEFAULT_FONT_FAMILY, sizes[i], styles[j]);
+			assert(font);
+
+			release(font);
+		}
+	}
+
+	const double time = (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+
+	printf("%-4s %8.2f ms to resolve %zu fonts\n", run, time, lengthof(sizes) * lengthof(styles));
+
+	SDL_GL_DeleteContext(context);
+	SDL_DestroyWindow(window);
+
+	SDL_Quit();
+}
+
+/**
+ * @brief Times font resolution at startup, without and then with the font resolution cache.
+ * @details Fontconfig and the resolution cache are initialized once per process, so each run
+ * is timed in a child process.
+ */
+int main(int argc, char *argv[]) {
+
+	if (argc > 1) {
+		if (strcmp(argv[1], "cold") == 0) {
+			removeResolutionCache();
+		}
+
+		timeFontResolution(argv[1]);
+		return 0;
+	}
+
+	char command[4096];
+
+	snprintf(command, sizeof(command), "\"%s\" cold", argv[0]);
+	if (system(command)) {
+		return 1;
+	}
+
+	snprintf(command, sizeof(command), "\"%s\" warm", argv[0]);
+	if (system(command)) {
+		return 1;
+	}
+
+	return 0;
+}
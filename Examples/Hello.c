@@ -28,6 +28,11 @@
 
 #include "HelloViewController.h"
 
+/**
+ * @brief The interval at which the animated scene is redrawn when the user interface is idle.
+ */
+#define SCENE_FRAME_MILLIS 16
+
 static void drawScene(SDL_Window *window);
 
 /**
@@ -53,22 +58,42 @@ int main(int argc, char *argv[]) {
 
 	WindowController *windowController = $(alloc(WindowController), initWithWindow, window);
 
+	windowController->renderer->compositesViews = true;
+
 	ViewController *viewController = $((ViewController *) alloc(HelloViewController), init);
 
 	$(windowController, setViewController, viewController);
 
+	_Bool quit = false;
+	Uint32 lastFrame = 0;
+
 	while (true) {
 		SDL_Event event;
 
-		if (SDL_PollEvent(&event)) {
+		while (SDL_PollEvent(&event)) {
 
 			$(windowController, respondToEvent, &event);
 
 			if (event.type == SDL_QUIT) {
-				break;
+				quit = true;
 			}
 		}
 
+		if (quit) {
+			break;
+		}
+
+		// when the user interface is unchanged, only the animated scene needs redrawing, so
+		// sleep until an event arrives or the next scene frame is due, rather than spinning
+
+		const Uint32 elapsed = SDL_GetTicks() - lastFrame;
+		if ($(windowController, needsRender) == false && elapsed < SCENE_FRAME_MILLIS) {
+			SDL_WaitEventTimeout(NULL, SCENE_FRAME_MILLIS - elapsed);
+			continue;
+		}
+
+		lastFrame = SDL_GetTicks();
+
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
 		drawScene(window);
@@ -99,7 +99,11 @@ static ident valueForColumnAndRow(const TableView *tableView, const TableColumn
  */
 static TableCellView *cellForColumnAndRow(const TableView *tableView, const TableColumn *column, size_t row) {
 
-	TableCellView *cell = $(alloc(TableCellView), initWithFrame, NULL);
+	TableCellView *cell = $(tableView, dequeueReusableCell, column);
+	if (cell == NULL) {
+		cell = $(alloc(TableCellView), initWithFrame, NULL);
+	}
+
 	const intptr_t value = (intptr_t) valueForColumnAndRow(tableView, column, row);
 
 	char text[8];
@@ -153,7 +157,10 @@ static ident objectForItemAtIndexPath(const CollectionView *collectionView, cons
  */
 static CollectionItemView *itemForObjectAtIndexPath(const CollectionView *collectionView, const IndexPath *indexPath) {
 
-	CollectionItemView *item = $(alloc(CollectionItemView), initWithFrame, NULL);
+	CollectionItemView *item = $(collectionView, dequeueReusableItem);
+	if (item == NULL) {
+		item = $(alloc(CollectionItemView), initWithFrame, NULL);
+	}
 
 	char text[64];
 	snprintf(text, sizeof(text), "%zd", $(indexPath, indexAtPosition, 0));
@@ -0,0 +1,192 @@
+/*
+ * ObjectivelyMVC: MVC framework for OpenGL and SDL2 in c.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <Objectively.h>
+#include <ObjectivelyMVC.h>
+
+/**
+ * @brief The count of rows.
+ */
+#define ROWS 100000
+
+/**
+ * @brief The count of times each column is sorted, alternating its order.
+ */
+#define ITERATIONS 10
+
+/**
+ * @brief The row values, by column.
+ */
+static struct {
+	intptr_t integers[ROWS];
+	Number *doubles[ROWS];
+	String *strings[ROWS];
+} values;
+
+/**
+ * @see TableViewDataSource::numberOfRows
+ */
+static size_t numberOfRows(const TableView *tableView) {
+	return ROWS;
+}
+
+/**
+ * @see TableViewDataSource::valueForColumnAndRow
+ */
+static ident valueForColumnAndRow(const TableView *tableView, const TableColumn *column, size_t row) {
+
+	switch (column->valueType) {
+		case TableColumnValueTypeInteger:
+			return (ident) values.integers[row];
+		case TableColumnValueTypeDouble:
+			return values.doubles[row];
+		default:
+			return values.strings[row];
+	}
+}
+
+/**
+ * @see TableViewDelegate::cellForColumnAndRow
+ */
+static TableCellView *cellForColumnAndRow(const TableView *tableView, const TableColumn *column, size_t row) {
+
+	TableCellView *cell = $(tableView, dequeueReusableCell, column);
+	if (cell == NULL) {
+		cell = $(alloc(TableCellView), initWithFrame, NULL);
+	}
+
+	return cell;
+}
+
+/**
+ * @return The elapsed time since the given counter, in milliseconds.
+ */
+static double elapsed(Uint64 start) {
+	return (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+/**
+ * @brief Adds a column of the given value type to the TableView.
+ */
+static TableColumn *addColumn(TableView *tableView, const char *identifier, TableColumnValueType valueType) {
+
+	TableColumn *column = $(alloc(TableColumn), initWithIdentifier, identifier);
+	assert(column);
+
+	column->valueType = valueType;
+
+	$(tableView, addColumn, column);
+	release(column);
+
+	return column;
+}
+
+/**
+ * @brief Times TableView::reloadData sorted by the given column.
+ */
+static void timeReloadData(TableView *tableView, TableColumn *column) {
+
+	$(tableView, setSortColumn, column);
+
+	double time = 0.0;
+
+	for (int i = 0; i < ITERATIONS; i++) {
+
+		const Uint64 start = SDL_GetPerformanceCounter();
+
+		$(tableView, reloadData);
+
+		time += elapsed(start);
+
+		$(tableView, setSortColumn, column);
+	}
+
+	printf("%-8s %8.2f ms per reloadData\n", column ? column->identifier : "unsorted", time / ITERATIONS);
+
+	$(tableView, setSortColumn, NULL);
+}
+
+/**
+ * @brief Times the cost of sorting a large TableView by each column value type.
+ */
+int main(int argc, char *argv[]) {
+
+	SDL_Init(SDL_INIT_VIDEO);
+
+	SDL_Window *window = SDL_CreateWindow(__FILE__,
+		SDL_WINDOWPOS_UNDEFINED,
+		SDL_WINDOWPOS_UNDEFINED,
+		1024,
+		768,
+		SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN
+	);
+
+	SDL_GLContext *context = SDL_GL_CreateContext(window);
+
+	srand(0);
+
+	for (int i = 0; i < ROWS; i++) {
+		values.integers[i] = rand() - RAND_MAX / 2;
+		values.doubles[i] = $$(Number, numberWithValue, rand() / (double) RAND_MAX);
+		values.strings[i] = str("%08x", rand());
+	}
+
+	const SDL_Rect frame = MakeRect(0, 0, 1024, 768);
+
+	TableView *tableView = $(alloc(TableView), initWithFrame, &frame, ControlStyleDefault);
+	assert(tableView);
+
+	tableView->dataSource.numberOfRows = numberOfRows;
+	tableView->dataSource.valueForColumnAndRow = valueForColumnAndRow;
+	tableView->delegate.cellForColumnAndRow = cellForColumnAndRow;
+	tableView->virtualizesRows = true;
+
+	TableColumn *integers = addColumn(tableView, "integer", TableColumnValueTypeInteger);
+	TableColumn *doubles = addColumn(tableView, "double", TableColumnValueTypeDouble);
+	TableColumn *strings = addColumn(tableView, "string", TableColumnValueTypeString);
+
+	printf("%d rows, %d iterations\n", ROWS, ITERATIONS);
+
+	timeReloadData(tableView, NULL);
+	timeReloadData(tableView, integers);
+	timeReloadData(tableView, doubles);
+	timeReloadData(tableView, strings);
+
+	release(tableView);
+
+	for (int i = 0; i < ROWS; i++) {
+		release(values.doubles[i]);
+		release(values.strings[i]);
+	}
+
+	SDL_GL_DeleteContext(context);
+	SDL_DestroyWindow(window);
+
+	SDL_Quit();
+
+	return 0;
+}
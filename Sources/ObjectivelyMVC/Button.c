@@ -112,6 +112,13 @@ static _Bool captureEvent(Control *self, const SDL_Event *event) {
 	return super(Control, self, captureEvent, event);
 }
 
+/**
+ * @see Control::captureEventMask(const Control *)
+ */
+static int captureEventMask(const Control *self) {
+	return ViewEventMaskMouse;
+}
+
 #pragma mark - Button
 
 /**
@@ -158,6 +165,7 @@ static void initialize(Class *clazz) {
 	((ViewInterface *) clazz->def->interface)->sizeThatFits = sizeThatFits;
 
 	((ControlInterface *) clazz->def->interface)->captureEvent = captureEvent;
+	((ControlInterface *) clazz->def->interface)->captureEventMask = captureEventMask;
 
 	((ButtonInterface *) clazz->def->interface)->initWithFrame = initWithFrame;
 }
@@ -159,6 +159,13 @@ static _Bool captureEvent(Control *self, const SDL_Event *event) {
 	return super(Control, self, captureEvent, event);
 }
 
+/**
+ * @see Control::captureEventMask(const Control *)
+ */
+static int captureEventMask(const Control *self) {
+	return ViewEventMaskMouse;
+}
+
 #pragma mark - Checkbox
 
 /**
@@ -217,6 +224,7 @@ static void initialize(Class *clazz) {
 	((ViewInterface *) clazz->def->interface)->init = init;
 
 	((ControlInterface *) clazz->def->interface)->captureEvent = captureEvent;
+	((ControlInterface *) clazz->def->interface)->captureEventMask = captureEventMask;
 
 	((CheckboxInterface *) clazz->def->interface)->initWithFrame = initWithFrame;
 
@@ -90,6 +90,10 @@ static void setSelected(CollectionItemView *self, _Bool selected) {
 	} else {
 		self->view.borderWidth = 0;
 	}
+
+	$((View *) self, invalidateFrames);
+
+	$((View *) self, setNeedsDisplay);
 }
 
 #pragma mark - Class lifecycle
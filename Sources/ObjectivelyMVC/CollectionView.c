@@ -22,6 +22,8 @@
  */
 
 #include <assert.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <ObjectivelyMVC/CollectionView.h>
 
@@ -43,7 +45,11 @@ static void dealloc(Object *self) {
 
 	release(this->contentView);
 	release(this->items);
+	release(this->reusableItems);
 	release(this->scrollView);
+	release(this->spacer);
+
+	free(this->itemSelection);
 
 	super(Object, self, dealloc);
 }
@@ -62,7 +68,8 @@ static void awakeWithDictionary(View *self, const Dictionary *dictionary) {
 	const Inlet inlets[] = MakeInlets(
 		MakeInlet("axis", InletTypeEnum, &this->axis, (ident) CollectionViewAxisNames),
 		MakeInlet("itemSize", InletTypeSize, &this->itemSize, NULL),
-		MakeInlet("itemSpacing", InletTypeSize, &this->itemSpacing, NULL)
+		MakeInlet("itemSpacing", InletTypeSize, &this->itemSpacing, NULL),
+		MakeInlet("virtualizesItems", InletTypeBool, &this->virtualizesItems, NULL)
 	);
 
 	$(self, bind, dictionary, inlets);
@@ -76,45 +83,209 @@ static View *init(View *self) {
 }
 
 /**
- * @see View::layoutSubviews(View *)
+ * @brief Returns the number of items in each line along the layout axis.
  */
-static void layoutSubviews(View *self) {
+static size_t itemsPerLine(const CollectionView *self) {
+
+	const SDL_Rect bounds = $((View *) self, bounds);
+
+	int available, stride;
+	switch (self->axis) {
+		case CollectionViewAxisVertical:
+			available = bounds.w - bounds.x - self->itemSize.w;
+			stride = self->itemSize.w + self->itemSpacing.w;
+			break;
+		case CollectionViewAxisHorizontal:
+			available = bounds.h - bounds.y - self->itemSize.h;
+			stride = self->itemSize.h + self->itemSpacing.h;
+			break;
+	}
 
-	CollectionView *this = (CollectionView *) self;
+	if (stride > 0) {
+		return max(available / stride, 0) + 1;
+	}
 
-	const SDL_Rect bounds = $(self, bounds);
+	return 1;
+}
 
-	int x = bounds.x, y = bounds.y;
+/**
+ * @brief Positions the given item at the grid location of the given index.
+ */
+static void layoutItem(const CollectionView *self, CollectionItemView *item, size_t index, size_t itemsPerLine) {
 
-	const Array *items = (Array *) this->items;
-	for (size_t i = 0; i < items->count; i++) {
+	const SDL_Rect bounds = $((View *) self, bounds);
+
+	const int line = index / itemsPerLine;
+	const int position = index % itemsPerLine;
+
+	SDL_Rect frame = MakeRect(0, 0, self->itemSize.w, self->itemSize.h);
+
+	switch (self->axis) {
+		case CollectionViewAxisVertical:
+			frame.x = bounds.x + position * (self->itemSize.w + self->itemSpacing.w);
+			frame.y = bounds.y + line * (self->itemSize.h + self->itemSpacing.h);
+			break;
+		case CollectionViewAxisHorizontal:
+			frame.x = bounds.x + line * (self->itemSize.w + self->itemSpacing.w);
+			frame.y = bounds.y + position * (self->itemSize.h + self->itemSpacing.h);
+			break;
+	}
+
+	if (SDL_RectEquals(&item->view.frame, &frame) == false) {
+		item->view.frame = frame;
+
+		$((View *) item, invalidateFrames);
+	}
+}
+
+/**
+ * @brief Creates the item at the given index with the delegate.
+ */
+static CollectionItemView *createItem(CollectionView *self, size_t index) {
+
+	IndexPath *indexPath = $(alloc(IndexPath), initWithIndex, index);
+
+	CollectionItemView *item = self->delegate.itemForObjectAtIndexPath(self, indexPath);
+	assert(item);
+
+	release(indexPath);
+
+	$(item, setSelected, self->itemSelection[index]);
+
+	return item;
+}
+
+/**
+ * @brief Removes the given item, making it available to CollectionView::dequeueReusableItem.
+ * @remarks The reuse queue is bounded by the number of materialized items.
+ */
+static void recycleItem(CollectionView *self, CollectionItemView *item) {
+
+	if (self->reusableItems->array.count < self->items->array.count) {
+		$(self->reusableItems, addObject, item);
+	}
+
+	$(self->contentView, removeSubview, (View *) item);
+}
+
+/**
+ * @brief Materializes and positions the items intersecting the visible area, and recycles those
+ * which do not.
+ * @remarks Unless `virtualizesItems` is set, all items are materialized.
+ */
+static void layoutVisibleItems(CollectionView *self) {
+
+	const size_t perLine = itemsPerLine(self);
+	const size_t lines = (self->numberOfItems + perLine - 1) / perLine;
 
-		CollectionItemView *item = (CollectionItemView *) $(items, objectAtIndex, i);
+	const SDL_Rect bounds = $((View *) self, bounds);
 
-		item->view.frame.x = x;
-		item->view.frame.y = y;
-		item->view.frame.w = this->itemSize.w;
-		item->view.frame.h = this->itemSize.h;
+	const int strideW = self->itemSize.w + self->itemSpacing.w;
+	const int strideH = self->itemSize.h + self->itemSpacing.h;
 
-		switch (this->axis) {
+	size_t first = 0, last = self->numberOfItems;
+	SDL_Rect extent = MakeRect(0, 0, 0, 0);
+
+	if (self->virtualizesItems) {
+
+		const SDL_Rect visible = $((View *) self->scrollView, bounds);
+		const View *contentView = self->contentView;
+
+		int top, size, origin, stride;
+		switch (self->axis) {
 			case CollectionViewAxisVertical:
-				x += this->itemSize.w + this->itemSpacing.w;
-				if (x + this->itemSize.w > bounds.w) {
-					y += this->itemSize.h + this->itemSpacing.h;
-					x = bounds.x;
-				}
+				top = -self->scrollView->contentOffset.y - contentView->padding.top;
+				size = visible.h;
+				origin = bounds.y;
+				stride = strideH;
 				break;
 			case CollectionViewAxisHorizontal:
-				y += this->itemSize.h + this->itemSpacing.h;
-				if (y + this->itemSize.h > bounds.h) {
-					x += this->itemSize.w + this->itemSpacing.w;
-					y = bounds.y;
-				}
+				top = -self->scrollView->contentOffset.x - contentView->padding.left;
+				size = visible.w;
+				origin = bounds.x;
+				stride = strideW;
 				break;
 		}
+
+		if (stride > 0) {
+			const int firstLine = max((top - origin) / stride - COLLECTION_VIEW_OVERSCAN, 0);
+			const int lastLine = max((top + size - origin) / stride + 1 + COLLECTION_VIEW_OVERSCAN, 0);
+
+			first = min(firstLine * perLine, self->numberOfItems);
+			last = min(lastLine * perLine, self->numberOfItems);
+		}
+
+		if (self->numberOfItems) {
+			const int across = min(self->numberOfItems, perLine);
+
+			switch (self->axis) {
+				case CollectionViewAxisVertical:
+					extent.w = bounds.x + across * strideW - self->itemSpacing.w;
+					extent.h = bounds.y + lines * strideH - self->itemSpacing.h;
+					break;
+				case CollectionViewAxisHorizontal:
+					extent.w = bounds.x + lines * strideW - self->itemSpacing.w;
+					extent.h = bounds.y + across * strideH - self->itemSpacing.h;
+					break;
+			}
+		}
 	}
 
+	const Array *items = (Array *) self->items;
+	if (first != self->firstVisibleItem || last - first != items->count) {
+
+		MutableArray *visibleItems = $$(MutableArray, arrayWithCapacity, last - first);
+		assert(visibleItems);
+
+		for (size_t i = 0; i < items->count; i++) {
+
+			const size_t index = self->firstVisibleItem + i;
+			if (index < first || index >= last) {
+				recycleItem(self, $(items, objectAtIndex, i));
+			}
+		}
+
+		for (size_t i = first; i < last; i++) {
+
+			CollectionItemView *item;
+			if (i >= self->firstVisibleItem && i < self->firstVisibleItem + items->count) {
+				item = $(items, objectAtIndex, i - self->firstVisibleItem);
+				retain(item);
+			} else {
+				item = createItem(self, i);
+				$(self->contentView, addSubview, (View *) item);
+			}
+
+			$(visibleItems, addObject, item);
+			release(item);
+		}
+
+		release(self->items);
+		self->items = visibleItems;
+
+		self->firstVisibleItem = first;
+	}
+
+	items = (Array *) self->items;
+	for (size_t i = 0; i < items->count; i++) {
+		layoutItem(self, $(items, objectAtIndex, i), self->firstVisibleItem + i, perLine);
+	}
+
+	if (SDL_RectEquals(&self->spacer->frame, &extent) == false) {
+		self->spacer->frame = extent;
+
+		$((View *) self->scrollView, setNeedsLayout);
+	}
+}
+
+/**
+ * @see View::layoutSubviews(View *)
+ */
+static void layoutSubviews(View *self) {
+
 	super(View, self, layoutSubviews);
+
+	layoutVisibleItems((CollectionView *) self);
 }
 
 #pragma mark - Control
@@ -137,22 +308,22 @@ static _Bool captureEvent(Control *self, const SDL_Event *event) {
 				};
 
 				IndexPath *indexPath = $(this, indexPathForItemAtPoint, &point);
+				if (indexPath) {
 
-				const CollectionItemView *item = $(this, itemAtIndexPath, indexPath);
-				if (item) {
+					const _Bool isSelected = this->itemSelection[$(indexPath, indexAtPosition, 0)];
 
 					switch (self->selection) {
 						case ControlSelectionNone:
 							break;
 						case ControlSelectionSingle:
-							if (item->isSelected == false) {
+							if (isSelected == false) {
 								$(this, deselectAll);
 								$(this, selectItemAtIndexPath, indexPath);
 							}
 							break;
 						case ControlSelectionMultiple:
 							if (SDL_GetModState() & (KMOD_CTRL | KMOD_GUI)) {
-								if (item->isSelected) {
+								if (isSelected) {
 									$(this, deselectItemAtIndexPath, indexPath);
 								} else {
 									$(this, selectItemAtIndexPath, indexPath);
@@ -182,6 +353,13 @@ static _Bool captureEvent(Control *self, const SDL_Event *event) {
 	return super(Control, self, captureEvent, event);
 }
 
+/**
+ * @see Control::captureEventMask(const Control *)
+ */
+static int captureEventMask(const Control *self) {
+	return ViewEventMaskMouse;
+}
+
 #pragma mark - CollectionView
 
 /**
@@ -196,6 +374,11 @@ static void deselectAll_enumerate(const Array *array, ident obj, ident data) {
  * @memberof CollectionView
  */
 static void deselectAll(CollectionView *self) {
+
+	if (self->numberOfItems) {
+		memset(self->itemSelection, 0, self->numberOfItems * sizeof(_Bool));
+	}
+
 	$((Array *) self->items, enumerateObjects, deselectAll_enumerate, NULL);
 }
 
@@ -206,6 +389,11 @@ static void deselectAll(CollectionView *self) {
 static void deselectItemAtIndexPath(CollectionView *self, const IndexPath *indexPath) {
 
 	if (indexPath) {
+		const size_t index = $(indexPath, indexAtPosition, 0);
+		if (index < self->numberOfItems) {
+			self->itemSelection[index] = false;
+		}
+
 		CollectionItemView *item = $(self, itemAtIndexPath, indexPath);
 		if (item) {
 			$(item, setSelected, false);
@@ -217,7 +405,27 @@ static void deselectItemAtIndexPath(CollectionView *self, const IndexPath *index
  * @brief ArrayEnumerator for item deselection.
  */
 static void deselectItemsAtIndexPaths_enumerate(const Array *array, ident obj, ident data) {
-	$((CollectionItemView *) obj, setSelected, false);
+	$((CollectionView *) data, deselectItemAtIndexPath, (IndexPath *) obj);
+}
+
+/**
+ * @fn CollectionItemView *CollectionView::dequeueReusableItem(const CollectionView *self)
+ * @memberof CollectionView
+ */
+static CollectionItemView *dequeueReusableItem(const CollectionView *self) {
+
+	const Array *reusableItems = (Array *) self->reusableItems;
+	if (reusableItems->count) {
+
+		CollectionItemView *item = $(reusableItems, lastObject);
+		retain(item);
+
+		$(self->reusableItems, removeLastObject);
+
+		return item;
+	}
+
+	return NULL;
 }
 
 /**
@@ -240,31 +448,34 @@ static IndexPath *indexPathForItemAtPoint(const CollectionView *self, const SDL_
 	if (self->itemSize.w && self->itemSize.h) {
 
 		const SDL_Rect frame = $(self->contentView, renderFrame);
+		const SDL_Rect bounds = $((View *) self, bounds);
 
 		const int itemWidth = self->itemSize.w + self->itemSpacing.w;
 		const int itemHeight = self->itemSize.h + self->itemSpacing.h;
 
-		const int rows = frame.h / itemHeight;
-		const int cols = frame.w / itemWidth;
+		const int x = point->x - frame.x - self->contentView->padding.left - bounds.x;
+		const int y = point->y - frame.y - self->contentView->padding.top - bounds.y;
 
-		const int x = point->x - frame.x;
-		const int y = point->y - frame.y;
+		if (x >= 0 && y >= 0) {
 
-		const int row = y / itemHeight;
-		const int col = x / itemWidth;
+			const size_t perLine = itemsPerLine(self);
 
-		int index;
-		switch (self->axis) {
-			case CollectionViewAxisVertical:
-				index = row * cols + col;
-				break;
-			case CollectionViewAxisHorizontal:
-				index = col * rows + row;
-				break;
-		}
+			const size_t row = y / itemHeight;
+			const size_t col = x / itemWidth;
 
-		if (index < self->items->array.count) {
-			return $(alloc(IndexPath), initWithIndex, index);
+			size_t index;
+			switch (self->axis) {
+				case CollectionViewAxisVertical:
+					index = col < perLine ? row * perLine + col : self->numberOfItems;
+					break;
+				case CollectionViewAxisHorizontal:
+					index = row < perLine ? col * perLine + row : self->numberOfItems;
+					break;
+			}
+
+			if (index < self->numberOfItems) {
+				return $(alloc(IndexPath), initWithIndex, index);
+			}
 		}
 	}
 
@@ -279,12 +490,23 @@ static IndexPath *indexPathForItem(const CollectionView *self, const CollectionI
 
 	const ssize_t index = $((Array *) self->items, indexOfObject, (ident) item);
 	if (index > -1) {
-		return $(alloc(IndexPath), initWithIndex, index);
+		return $(alloc(IndexPath), initWithIndex, self->firstVisibleItem + index);
 	}
 
 	return NULL;
 }
 
+/**
+ * @brief ScrollViewDelegate callback for materializing items as they are scrolled into view.
+ */
+static void didScroll(ScrollView *scrollView) {
+
+	CollectionView *this = scrollView->delegate.self;
+	if (this->virtualizesItems) {
+		layoutVisibleItems(this);
+	}
+}
+
 /**
  * @fn CollectionView *CollectionView::initWithFrame(CollectionView *self, const SDL_Rect *frame, ControlStyle style)
  * @memberof CollectionView
@@ -296,16 +518,27 @@ static CollectionView *initWithFrame(CollectionView *self, const SDL_Rect *frame
 
 		self->items = $$(MutableArray, array);
 
+		self->reusableItems = $$(MutableArray, array);
+		assert(self->reusableItems);
+
 		self->contentView = $(alloc(View), initWithFrame, NULL);
 		assert(self->contentView);
 
 		self->contentView->autoresizingMask = ViewAutoresizingContain;
 
+		self->spacer = $(alloc(View), initWithFrame, NULL);
+		assert(self->spacer);
+
+		$(self->contentView, addSubview, self->spacer);
+
 		self->scrollView = $(alloc(ScrollView), initWithFrame, NULL, style);
 		assert(self->scrollView);
 
 		self->scrollView->control.view.autoresizingMask = ViewAutoresizingFill;
 
+		self->scrollView->delegate.self = self;
+		self->scrollView->delegate.didScroll = didScroll;
+
 		$(self->scrollView, setContentView, self->contentView);
 
 		$((View *) self, addSubview, (View *) self->scrollView);
@@ -346,8 +579,8 @@ static CollectionItemView *itemAtIndexPath(const CollectionView *self, const Ind
 		const Array *items = (Array *) self->items;
 		const size_t index = $(indexPath, indexAtPosition, 0);
 
-		if (index < items->count) {
-			return $(items, objectAtIndex, index);
+		if (index >= self->firstVisibleItem && index < self->firstVisibleItem + items->count) {
+			return $(items, objectAtIndex, index - self->firstVisibleItem);
 		}
 	}
 
@@ -373,22 +606,20 @@ static void reloadData(CollectionView *self) {
 	$((Array *) self->items, enumerateObjects, reloadData_removeItems, self->contentView);
 	$(self->items, removeAllObjects);
 
-	const size_t numberOfItems = self->dataSource.numberOfItems(self);
-	for (size_t i = 0; i < numberOfItems; i++) {
-
-		IndexPath *indexPath = $(alloc(IndexPath), initWithIndex, i);
+	self->firstVisibleItem = 0;
 
-		CollectionItemView *item = self->delegate.itemForObjectAtIndexPath(self, indexPath);
-		assert(item);
+	self->numberOfItems = self->dataSource.numberOfItems(self);
+	if (self->numberOfItems) {
 
-		$(self->items, addObject, item);
-		$(self->contentView, addSubview, (View *) item);
+		self->itemSelection = realloc(self->itemSelection, self->numberOfItems * sizeof(_Bool));
+		assert(self->itemSelection);
 
-		release(item);
-		release(indexPath);
+		memset(self->itemSelection, 0, self->numberOfItems * sizeof(_Bool));
 	}
 
-	self->control.view.needsLayout = true;
+	layoutVisibleItems(self);
+
+	$((View *) self, setNeedsLayout);
 }
 
 /**
@@ -403,6 +634,11 @@ static void selectAll_enumerate(const Array *array, ident obj, ident data) {
  * @memberof CollectionView
  */
 static void selectAll(CollectionView *self) {
+
+	if (self->numberOfItems) {
+		memset(self->itemSelection, true, self->numberOfItems * sizeof(_Bool));
+	}
+
 	$((Array *) self->items, enumerateObjects, selectAll_enumerate, NULL);
 }
 
@@ -414,13 +650,10 @@ static Array *selectionIndexPaths(const CollectionView *self) {
 
 	MutableArray *array = $$(MutableArray, array);
 
-	const Array *items = (Array *) self->items;
-	for (size_t i = 0; i < items->count; i++) {
-
-		const CollectionItemView *item = $(items, objectAtIndex, i);
-		if (item->isSelected) {
+	for (size_t i = 0; i < self->numberOfItems; i++) {
+		if (self->itemSelection[i]) {
 
-			IndexPath *indexPath = $(self, indexPathForItem, item);
+			IndexPath *indexPath = $(alloc(IndexPath), initWithIndex, i);
 			$(array, addObject, indexPath);
 
 			release(indexPath);
@@ -437,6 +670,11 @@ static Array *selectionIndexPaths(const CollectionView *self) {
 static void selectItemAtIndexPath(CollectionView *self, const IndexPath *indexPath) {
 
 	if (indexPath) {
+		const size_t index = $(indexPath, indexAtPosition, 0);
+		if (index < self->numberOfItems) {
+			self->itemSelection[index] = true;
+		}
+
 		CollectionItemView *item = $(self, itemAtIndexPath, indexPath);
 		if (item) {
 			$(item, setSelected, true);
@@ -476,10 +714,12 @@ static void initialize(Class *clazz) {
 	((ViewInterface *) clazz->def->interface)->layoutSubviews = layoutSubviews;
 
 	((ControlInterface *) clazz->def->interface)->captureEvent = captureEvent;
+	((ControlInterface *) clazz->def->interface)->captureEventMask = captureEventMask;
 
 	((CollectionViewInterface *) clazz->def->interface)->deselectAll = deselectAll;
 	((CollectionViewInterface *) clazz->def->interface)->deselectItemAtIndexPath = deselectItemAtIndexPath;
 	((CollectionViewInterface *) clazz->def->interface)->deselectItemsAtIndexPaths = deselectItemsAtIndexPaths;
+	((CollectionViewInterface *) clazz->def->interface)->dequeueReusableItem = dequeueReusableItem;
 	((CollectionViewInterface *) clazz->def->interface)->indexPathForItem = indexPathForItem;
 	((CollectionViewInterface *) clazz->def->interface)->indexPathForItemAtPoint = indexPathForItemAtPoint;
 	((CollectionViewInterface *) clazz->def->interface)->initWithFrame = initWithFrame;
@@ -98,6 +98,8 @@ struct CollectionViewDelegate {
 	 * @param collectionView The CollectionView.
 	 * @param indexPath The index path.
 	 * @return The item for the index path.
+	 * @remarks Implementations should first attempt to reuse an item with
+	 * CollectionView::dequeueReusableItem, and create a new item only if that returns `NULL`.
 	 */
 	CollectionItemView *(*itemForObjectAtIndexPath)(const CollectionView *collectionView, const IndexPath *indexPath);
 };
@@ -107,6 +109,8 @@ struct CollectionViewDelegate {
 #define DEFAULT_COLLECTION_VIEW_VERTICAL_SPACING 10
 #define DEFAULT_COLLECTION_VIEW_ITEM_SIZE 48
 
+#define COLLECTION_VIEW_OVERSCAN 1
+
 /**
  * @brief CollectionViews display items in a grid.
  * @extends Control
@@ -146,10 +150,22 @@ struct CollectionView {
 	CollectionViewDelegate delegate;
 
 	/**
-	 * @brief The items.
+	 * @brief The index of the first materialized item.
+	 * @private
+	 */
+	size_t firstVisibleItem;
+
+	/**
+	 * @brief The materialized items, beginning with the item at `firstVisibleItem`.
 	 */
 	MutableArray *items;
 
+	/**
+	 * @brief The selection state of each item.
+	 * @private
+	 */
+	_Bool *itemSelection;
+
 	/**
 	 * @brief The item size.
 	 */
@@ -160,10 +176,36 @@ struct CollectionView {
 	 */
 	SDL_Size itemSpacing;
 
+	/**
+	 * @brief The number of items, as reported by the data source at the last reload.
+	 */
+	size_t numberOfItems;
+
+	/**
+	 * @brief Items recycled by this CollectionView, available for reuse.
+	 * @private
+	 */
+	MutableArray *reusableItems;
+
 	/**
 	 * @brief The scroll view.
 	 */
 	ScrollView *scrollView;
+
+	/**
+	 * @brief A spacer sized to the extent of all items, so that any item may be scrolled to.
+	 * @private
+	 */
+	View *spacer;
+
+	/**
+	 * @brief Set to `true` to materialize only those items intersecting the visible area.
+	 * @details The grid geometry is computed from `itemSize`, `itemSpacing` and `axis`, and only
+	 * the items within the visible area, plus `COLLECTION_VIEW_OVERSCAN` lines on either side,
+	 * are instantiated. Items scrolled out of view are made available to
+	 * CollectionView::dequeueReusableItem.
+	 */
+	_Bool virtualizesItems;
 };
 
 /**
@@ -202,6 +244,18 @@ struct CollectionViewInterface {
 	 */
 	void (*deselectItemsAtIndexPaths)(CollectionView *self, const Array *indexPaths);
 
+	/**
+	 * @fn CollectionItemView *CollectionView::dequeueReusableItem(const CollectionView *self)
+	 * @brief Dequeues a previously recycled item.
+	 * @param self The CollectionView.
+	 * @return A retained CollectionItemView, or `NULL` if none is available.
+	 * @remarks This method is intended to be called from
+	 * CollectionViewDelegate::itemForObjectAtIndexPath. Dequeued items retain their previous
+	 * contents, and must be reconfigured for their new index path.
+	 * @memberof CollectionView
+	 */
+	CollectionItemView *(*dequeueReusableItem)(const CollectionView *self);
+
 	/**
 	 * @fn CollectionView *CollectionView::init(CollectionView *self, const SDL_Rect *frame, ControlStyle style)
 	 * @brief Initializes this CollectionView with the specified frame and style.
@@ -235,7 +289,7 @@ struct CollectionViewInterface {
 	 * @fn CollectionItemView *CollectionView::itemAtIndexPath(const CollectionView *self, const IndexPath *indexPath)
 	 * @param self The CollectionView.
 	 * @param indexPath An index path.
-	 * @return The item at the specified index path, or `NULL`.
+	 * @return The item at the specified index path, or `NULL` if it is not materialized.
 	 * @memberof CollectionView
 	 */
 	CollectionItemView *(*itemAtIndexPath)(const CollectionView *self, const IndexPath *indexPath);
@@ -49,6 +49,40 @@ const EnumName ControlStyleNames[] = MakeEnumNames(
 	MakeEnumName(ControlStyleCustom)
 );
 
+/**
+ * @brief The Actions bound to a Control for a single event type.
+ */
+typedef struct ControlActionGroup {
+
+	/**
+	 * @brief The event type.
+	 */
+	Uint32 eventType;
+
+	/**
+	 * @brief The Actions, in the order they were added. Each is retained by this group, so
+	 * that they remain valid regardless of any changes to `Control::actions`.
+	 */
+	Action **actions;
+
+	/**
+	 * @brief The count and capacity of actions.
+	 */
+	size_t count, capacity;
+
+	/**
+	 * @brief The next group in this group's bucket.
+	 */
+	struct ControlActionGroup *next;
+} ControlActionGroup;
+
+/**
+ * @brief A hash table of ControlActionGroups, keyed by event type.
+ */
+struct ControlActionTable {
+	ControlActionGroup *buckets[DEFAULT_CONTROL_ACTION_BUCKETS];
+};
+
 #define _Class _Control
 
 #pragma mark - Object
@@ -62,9 +96,51 @@ static void dealloc(Object *self) {
 
 	release(this->actions);
 
+	for (size_t i = 0; i < lengthof(this->actionTable->buckets); i++) {
+
+		ControlActionGroup *group = this->actionTable->buckets[i];
+		while (group) {
+			ControlActionGroup *next = group->next;
+
+			for (size_t j = 0; j < group->count; j++) {
+				release(group->actions[j]);
+			}
+
+			free(group->actions);
+			free(group);
+
+			group = next;
+		}
+	}
+
+	free(this->actionTable);
+
 	super(Object, self, dealloc);
 }
 
+#pragma mark - Action table
+
+/**
+ * @return The bucket for the given event type.
+ */
+static ControlActionGroup **actionBucket(const Control *self, Uint32 eventType) {
+	return &self->actionTable->buckets[(eventType ^ (eventType >> 8)) & (DEFAULT_CONTROL_ACTION_BUCKETS - 1)];
+}
+
+/**
+ * @return The group of Actions for the given event type, or `NULL`.
+ */
+static ControlActionGroup *actionGroup(const Control *self, Uint32 eventType) {
+
+	for (ControlActionGroup *group = *actionBucket(self, eventType); group; group = group->next) {
+		if (group->eventType == eventType) {
+			return group;
+		}
+	}
+
+	return NULL;
+}
+
 #pragma mark - View
 
 /**
@@ -183,19 +259,24 @@ static void respondToEvent(View *self, const SDL_Event *event) {
 
 	const ControlState state = this->state;
 
-	if (memcmp(&_capturedEvent, event, sizeof(*event))) {
-		if ($(this, captureEvent, event)) {
+	if (self->eventMask & MVC_EventMask(event->type)) {
+
+		const _Bool isCaptured = _capturedEvent.type == event->type
+			&& _capturedEvent.common.timestamp == event->common.timestamp
+			&& memcmp(&_capturedEvent, event, sizeof(*event)) == 0;
+
+		if (isCaptured == false && $(this, captureEvent, event)) {
 			_capturedEvent = *event;
 
-			Action *action = $(this, actionForEvent, event);
-			if (action) {
-				action->function(this, event, action->sender, action->data);
-			}
+			$(self, setNeedsDisplay);
+
+			$(this, sendActionsForEvent, event);
 		}
 	}
 
 	if (this->state != state) {
 		$(this, stateDidChange);
+		$(self, setNeedsDisplay);
 	}
 
 	super(View, self, respondToEvent, event);
@@ -209,13 +290,9 @@ static void respondToEvent(View *self, const SDL_Event *event) {
  */
 static Action *actionForEvent(const Control *self, const SDL_Event *event) {
 
-	Array *actions = (Array *) self->actions;
-	for (size_t i = 0; i < actions->count; i++) {
-
-		Action *action = (Action *) $(actions, objectAtIndex, i);
-		if (action->eventType == event->type) {
-			return action;
-		}
+	const ControlActionGroup *group = actionGroup(self, event->type);
+	if (group) {
+		return group->actions[0];
 	}
 
 	return NULL;
@@ -231,7 +308,29 @@ static void addActionForEventType(Control *self, SDL_EventType eventType, Action
 
 	$(self->actions, addObject, action);
 
+	ControlActionGroup *group = actionGroup(self, eventType);
+	if (group == NULL) {
+		group = calloc(1, sizeof(ControlActionGroup));
+		assert(group);
+
+		ControlActionGroup **bucket = actionBucket(self, eventType);
+
+		group->eventType = eventType;
+		group->next = *bucket;
+		*bucket = group;
+	}
+
+	if (group->count == group->capacity) {
+		group->capacity = group->capacity ? group->capacity * 2 : 4;
+		group->actions = realloc(group->actions, group->capacity * sizeof(Action *));
+		assert(group->actions);
+	}
+
+	group->actions[group->count++] = retain(action);
+
 	release(action);
+
+	$((View *) self, setEventMask, self->view.eventMask | MVC_EventMask(eventType));
 }
 
 /**
@@ -242,6 +341,14 @@ static _Bool captureEvent(Control *self, const SDL_Event *event) {
 	return false;
 }
 
+/**
+ * @fn int Control::captureEventMask(const Control *self)
+ * @memberof Control
+ */
+static int captureEventMask(const Control *self) {
+	return ViewEventMaskMouse;
+}
+
 /**
  * @fn _Bool Control::enabled(const Control *self)
  * @memberof Control
@@ -266,6 +373,64 @@ static _Bool highlighted(const Control *self) {
 	return (self->state & ControlStateHighlighted) == ControlStateHighlighted;
 }
 
+/**
+ * @return The most general Class, up to Control, sharing the given Class's implementation of
+ * the interface function at the given offset.
+ */
+static const Class *initWithFrame_implementor(const Class *clazz, size_t offset) {
+
+	typedef void (*Function)(void);
+
+	const Function function = *(Function *) ((char *) clazz->def->interface + offset);
+
+	while (clazz != _Control()) {
+
+		const Function inherited = *(Function *) ((char *) clazz->superclass->def->interface + offset);
+		if (inherited != function) {
+			break;
+		}
+
+		clazz = clazz->superclass;
+	}
+
+	return clazz;
+}
+
+/**
+ * @return True if the given Class is, or descends from, the given superclass.
+ */
+static _Bool initWithFrame_isKindOfClass(const Class *clazz, const Class *superclass) {
+
+	for (const Class *c = clazz; c; c = c->superclass) {
+		if (c == superclass) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @return The initial event mask of the given Control.
+ * @remarks Control::captureEventMask is only trusted if it is implemented by the same Class as,
+ * or a subclass of, the Classes implementing Control::captureEvent and View::respondToEvent.
+ * Otherwise, a subclass handles events the mask may not describe, and so all events are consumed.
+ */
+static int initWithFrame_eventMask(const Control *self) {
+
+	const Class *clazz = self->view.object.clazz;
+
+	const Class *mask = initWithFrame_implementor(clazz, offsetof(ControlInterface, captureEventMask));
+	const Class *capture = initWithFrame_implementor(clazz, offsetof(ControlInterface, captureEvent));
+	const Class *respond = initWithFrame_implementor(clazz, offsetof(ViewInterface, respondToEvent));
+
+	if (initWithFrame_isKindOfClass(mask, capture) && initWithFrame_isKindOfClass(mask, respond)) {
+		return $(self, captureEventMask);
+	}
+
+	return ViewEventMaskAll;
+}
+
 /**
  * @fn Control Control::initWithFrame(Control *self, const SDL_Rect *frame, ControlStyle style)
  * @memberof Control
@@ -278,6 +443,11 @@ static Control *initWithFrame(Control *self, const SDL_Rect *frame, ControlStyle
 		self->actions = $$(MutableArray, array);
 		assert(self->actions);
 
+		self->actionTable = calloc(1, sizeof(struct ControlActionTable));
+		assert(self->actionTable);
+
+		self->view.eventMask = initWithFrame_eventMask(self);
+
 		self->style = style;
 		if (self->style == ControlStyleDefault) {
 
@@ -303,6 +473,31 @@ static _Bool selected(const Control *self) {
 	return (self->state & ControlStateSelected) == ControlStateSelected;
 }
 
+/**
+ * @fn void Control::sendActionsForEvent(Control *self, const SDL_Event *event)
+ * @memberof Control
+ */
+static void sendActionsForEvent(Control *self, const SDL_Event *event) {
+
+	const ControlActionGroup *group = actionGroup(self, event->type);
+	if (group) {
+
+		retain(self);
+
+		const size_t count = group->count;
+		for (size_t i = 0; i < count; i++) {
+
+			Action *action = retain(group->actions[i]);
+
+			action->function(self, event, action->sender, action->data);
+
+			release(action);
+		}
+
+		release(self);
+	}
+}
+
 /**
  * @fn void Control::stateDidChange(Control *self)
  * @memberof Control
@@ -333,11 +528,13 @@ static void initialize(Class *clazz) {
 	((ControlInterface *) clazz->def->interface)->actionForEvent = actionForEvent;
 	((ControlInterface *) clazz->def->interface)->addActionForEventType = addActionForEventType;
 	((ControlInterface *) clazz->def->interface)->captureEvent = captureEvent;
+	((ControlInterface *) clazz->def->interface)->captureEventMask = captureEventMask;
 	((ControlInterface *) clazz->def->interface)->enabled = enabled;
 	((ControlInterface *) clazz->def->interface)->focused = focused;
 	((ControlInterface *) clazz->def->interface)->highlighted = highlighted;
 	((ControlInterface *) clazz->def->interface)->initWithFrame = initWithFrame;
 	((ControlInterface *) clazz->def->interface)->selected = selected;
+	((ControlInterface *) clazz->def->interface)->sendActionsForEvent = sendActionsForEvent;
 	((ControlInterface *) clazz->def->interface)->stateDidChange = stateDidChange;
 }
 
@@ -83,6 +83,7 @@ typedef enum {
 
 #define DEFAULT_CONTROL_HEIGHT 32
 #define DEFAULT_CONTROL_PADDING 8
+#define DEFAULT_CONTROL_ACTION_BUCKETS 16
 
 typedef struct ControlInterface ControlInterface;
 
@@ -110,6 +111,12 @@ struct Control {
 	 */
 	MutableArray *actions;
 
+	/**
+	 * @brief The Actions bound to this Control, indexed by event type.
+	 * @private
+	 */
+	struct ControlActionTable *actionTable;
+
 	/**
 	 * @brief The ControlBevelType.
 	 */
@@ -145,6 +152,8 @@ struct ControlInterface {
 	 * @fn Action *Control::actionForEvent(const Control *self, const SDL_Event *event)
 	 * @param self The Control.
 	 * @param event An SDL_Event.
+	 * @return The first Action bound to the event's type, or `NULL`.
+	 * @see Control::sendActionsForEvent(Control *, const SDL_Event *)
 	 * @memberof Control
 	 */
 	Action *(*actionForEvent)(const Control *self, const SDL_Event *event);
@@ -167,11 +176,25 @@ struct ControlInterface {
 	 * @param self The Control.
 	 * @param event The event.
 	 * @return True if the Event was captured, false otherwise.
-	 * @remarks Subclasses should override this method to capture events.
+	 * @remarks Subclasses should override this method to capture events. Only events of the types
+	 * in the View's `eventMask` are offered.
+	 * @see Control::captureEventMask(const Control *)
 	 * @memberof Control
 	 */
 	_Bool (*captureEvent)(Control *self, const SDL_Event *event);
 
+	/**
+	 * @fn int Control::captureEventMask(const Control *self)
+	 * @param self The Control.
+	 * @return The ViewEventMask of the event types captured by Control::captureEvent.
+	 * @remarks Control::initWithFrame initializes the View's `eventMask` with this, and then adds
+	 * the event types of Actions as they are added. Subclasses which override Control::captureEvent
+	 * should override this method too. If a subclass overrides Control::captureEvent or
+	 * View::respondToEvent without also overriding this method, the Control consumes all events.
+	 * @memberof Control
+	 */
+	int (*captureEventMask)(const Control *self);
+
 	/**
 	 * @fn _Bool Control::enabled(const Control *self)
 	 * @param self The Control.
@@ -215,6 +238,17 @@ struct ControlInterface {
 	 */
 	_Bool (*selected)(const Control *self);
 
+	/**
+	 * @fn void Control::sendActionsForEvent(Control *self, const SDL_Event *event)
+	 * @brief Invokes every Action bound to the event's type, in the order they were added.
+	 * @param self The Control.
+	 * @param event The event.
+	 * @remarks Actions are indexed by event type, so this costs only the Actions invoked. Actions
+	 * added by an Action while they are being invoked are first invoked for the next event.
+	 * @memberof Control
+	 */
+	void (*sendActionsForEvent)(Control *self, const SDL_Event *event);
+
 	/**
 	 * @fn void Control::stateDidChange(Control *self)
 	 * @brief Called when the state of this Control changes.
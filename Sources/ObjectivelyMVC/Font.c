@@ -22,34 +22,1160 @@
  */
 
 #include <assert.h>
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <fontconfig/fontconfig.h>
 
 #include <Objectively/MutableArray.h>
+#include <Objectively/MutableDictionary.h>
 #include <Objectively/String.h>
 
 #include <ObjectivelyMVC/Font.h>
 #include <ObjectivelyMVC/Log.h>
 #include <ObjectivelyMVC/View.h>
 
+#define FONT_GLYPH_RUN_SIZE 64
+
+/**
+ * @brief A cached measurement of a string.
+ */
+typedef struct {
+
+	/**
+	 * @brief The hash of the string.
+	 */
+	Uint32 hash;
+
+	/**
+	 * @brief A copy of the string, to resolve hash collisions.
+	 */
+	char *chars;
+
+	/**
+	 * @brief The size of the string, in points.
+	 */
+	int w, h;
+
+	/**
+	 * @brief The index of the next entry in this entry's bucket, or `-1`.
+	 */
+	int bucketNext;
+
+	/**
+	 * @brief The indexes of the more and less recently used entries, or `-1`.
+	 */
+	int prev, next;
+} FontMeasurement;
+
+/**
+ * @brief A bounded, least recently used cache of string measurements.
+ */
+struct FontMeasurementCache {
+
+	/**
+	 * @brief The entries.
+	 */
+	FontMeasurement entries[DEFAULT_FONT_MEASUREMENT_CACHE_SIZE];
+
+	/**
+	 * @brief The index of the first entry in each hash bucket, or `-1`.
+	 */
+	int buckets[DEFAULT_FONT_MEASUREMENT_CACHE_SIZE];
+
+	/**
+	 * @brief The count of entries in use.
+	 */
+	int count;
+
+	/**
+	 * @brief The indexes of the most and least recently used entries, or `-1`.
+	 */
+	int head, tail;
+};
+
+/**
+ * @brief A Fontconfig pattern, resolved to a font file.
+ */
+typedef struct {
+
+	/**
+	 * @brief The unparsed search pattern.
+	 */
+	char *key;
+
+	/**
+	 * @brief The path of the font file.
+	 */
+	char *path;
+
+	/**
+	 * @brief The point size.
+	 */
+	double size;
+
+	/**
+	 * @brief The face index within the font file.
+	 */
+	int index;
+} FontResolution;
+
+/**
+ * @brief The persistent cache of font resolutions.
+ */
+static struct {
+
+	/**
+	 * @brief The resolutions.
+	 */
+	FontResolution *entries;
+
+	/**
+	 * @brief The count of resolutions.
+	 */
+	size_t count;
+
+	/**
+	 * @brief True if the cache file has been read.
+	 */
+	_Bool isLoaded;
+
+	/**
+	 * @brief True if resolutions have been added since the cache file was read or written.
+	 */
+	_Bool isDirty;
+} _resolutions;
+
+/**
+ * @brief True if Fontconfig has been initialized.
+ */
+static _Bool _fontconfig;
+
+/**
+ * @brief A glyph to be rasterized on a worker thread.
+ */
+typedef struct FontGlyphJob {
+
+	/**
+	 * @brief The Font, retained until the glyph is packed into its atlas.
+	 */
+	Font *font;
+
+	/**
+	 * @brief The UCS-2 character.
+	 */
+	Uint16 character;
+
+	/**
+	 * @brief A copy of the Font's path, point size and face index, from which the worker opens
+	 * its own handle.
+	 */
+	char *path;
+	int size, index;
+
+	/**
+	 * @brief The rasterized glyph, or `NULL` on error.
+	 */
+	SDL_Surface *surface;
+
+	/**
+	 * @brief The next job in the queue.
+	 */
+	struct FontGlyphJob *next;
+} FontGlyphJob;
+
+/**
+ * @brief A run of glyphs sharing an atlas page, drawn with a single texture bind.
+ */
+typedef struct {
+
+	/**
+	 * @brief The atlas page texture.
+	 */
+	GLuint texture;
+
+	/**
+	 * @brief The texture coordinates and destinations of the glyphs.
+	 */
+	GLfloat texcoords[FONT_GLYPH_RUN_SIZE * 4];
+	SDL_Rect rects[FONT_GLYPH_RUN_SIZE];
+
+	/**
+	 * @brief The count of glyphs.
+	 */
+	size_t count;
+} FontGlyphRun;
+
+/**
+ * @brief A worker thread's handle to a font file.
+ * @remarks SDL_ttf is not thread-safe across a single TTF_Font, so each worker opens its own.
+ */
+typedef struct {
+
+	/**
+	 * @brief The path, point size and face index.
+	 */
+	char *path;
+	int size, index;
+
+	/**
+	 * @brief The TTF_Font.
+	 */
+	TTF_Font *font;
+} FontHandle;
+
+/**
+ * @brief The glyph rasterizer worker pool.
+ */
+static struct {
+
+	/**
+	 * @brief The worker threads.
+	 */
+	SDL_Thread *threads[DEFAULT_FONT_RASTERIZER_THREADS];
+
+	/**
+	 * @brief The count of worker threads.
+	 */
+	int numThreads;
+
+	/**
+	 * @brief The lock, which guards the queues and all FreeType face creation and destruction.
+	 */
+	SDL_mutex *lock;
+
+	/**
+	 * @brief Signaled when jobs are queued, or on shutdown.
+	 */
+	SDL_cond *cond;
+
+	/**
+	 * @brief The queued jobs, in first in, first out order.
+	 */
+	FontGlyphJob *jobs, *lastJob;
+
+	/**
+	 * @brief The finished jobs, awaiting Font::uploadGlyphs.
+	 */
+	FontGlyphJob *results;
+
+	/**
+	 * @brief True if the pool has been started, or failed to start.
+	 */
+	_Bool isStarted;
+
+	/**
+	 * @brief True if the workers should exit.
+	 */
+	_Bool isShutdown;
+} _rasterizer;
+
+static void closeFont(TTF_Font *font);
+
 #define _Class _Font
 
-#pragma mark - Object
+#pragma mark - Object
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	Font *this = (Font *) self;
+
+	closeFont(this->font);
+
+	FcStrFree((FcChar8 *) this->name);
+
+	free(this->path);
+
+	for (size_t i = 0; i < this->numPages; i++) {
+		if (this->pages[i].texture) {
+			glDeleteTextures(1, &this->pages[i].texture);
+		}
+		free(this->pages[i].pixels);
+	}
+
+	free(this->pages);
+
+	for (size_t i = 0; i < lengthof(this->glyphs); i++) {
+		free(this->glyphs[i]);
+	}
+
+	if (this->measurements) {
+		for (int i = 0; i < this->measurements->count; i++) {
+			free(this->measurements->entries[i].chars);
+		}
+		free(this->measurements);
+	}
+
+	super(Object, self, dealloc);
+}
+
+#pragma mark - Glyph atlas
+
+/**
+ * @brief Decodes the next UTF-8 sequence from the given characters.
+ * @param chars The characters, which are advanced past the decoded sequence.
+ * @return The UCS-2 character, or the replacement character for sequences outside of the BMP.
+ */
+static Uint16 decodeCharacter(const char **chars) {
+
+	const unsigned char *c = (const unsigned char *) *chars;
+
+	Uint32 ch;
+	size_t len;
+
+	if (c[0] < 0x80) {
+		ch = c[0], len = 1;
+	} else if ((c[0] & 0xe0) == 0xc0 && c[1]) {
+		ch = ((c[0] & 0x1f) << 6) | (c[1] & 0x3f), len = 2;
+	} else if ((c[0] & 0xf0) == 0xe0 && c[1] && c[2]) {
+		ch = ((c[0] & 0x0f) << 12) | ((c[1] & 0x3f) << 6) | (c[2] & 0x3f), len = 3;
+	} else {
+		ch = 0xfffd, len = 1;
+		while (c[len] && (c[len] & 0xc0) == 0x80) {
+			len++;
+		}
+	}
+
+	*chars += len;
+	return (Uint16) ch;
+}
+
+/**
+ * @brief Reserves a region of the given size in the glyph atlas, adding a page if necessary.
+ * @return The page index plus one, or `0` if the glyph will not fit on any page.
+ */
+static size_t packGlyph(Font *self, int w, int h, SDL_Rect *rect) {
+
+	if (w + 1 > DEFAULT_FONT_ATLAS_SIZE || h + 1 > DEFAULT_FONT_ATLAS_SIZE) {
+		MVC_LogWarn("Glyph of %dx%d exceeds atlas size\n", w, h);
+		return 0;
+	}
+
+	FontAtlasPage *page = self->numPages ? &self->pages[self->numPages - 1] : NULL;
+	if (page) {
+		if (page->x + w + 1 > DEFAULT_FONT_ATLAS_SIZE) {
+			page->x = 0;
+			page->y += page->shelfHeight;
+			page->shelfHeight = 0;
+		}
+		if (page->y + h + 1 > DEFAULT_FONT_ATLAS_SIZE) {
+			page = NULL;
+		}
+	}
+
+	if (page == NULL) {
+		self->pages = realloc(self->pages, ++self->numPages * sizeof(FontAtlasPage));
+		assert(self->pages);
+
+		page = &self->pages[self->numPages - 1];
+		memset(page, 0, sizeof(*page));
+
+		page->pixels = calloc(DEFAULT_FONT_ATLAS_SIZE * DEFAULT_FONT_ATLAS_SIZE, sizeof(Uint8));
+		assert(page->pixels);
+
+		page->dirtyMin = DEFAULT_FONT_ATLAS_SIZE;
+	}
+
+	*rect = MakeRect(page->x, page->y, w, h);
+
+	page->x += w + 1;
+	page->shelfHeight = max(page->shelfHeight, h + 1);
+
+	page->dirtyMin = min(page->dirtyMin, rect->y);
+	page->dirtyMax = max(page->dirtyMax, rect->y + rect->h);
+
+	return self->numPages;
+}
+
+/**
+ * @brief Uploads any dirty rows of the given atlas page, creating its texture if necessary.
+ */
+static void uploadPage(FontAtlasPage *page) {
+
+	if (page->texture == 0) {
+		glGenTextures(1, &page->texture);
+		glBindTexture(GL_TEXTURE_2D, page->texture);
+
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_FALSE);
+
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, DEFAULT_FONT_ATLAS_SIZE, DEFAULT_FONT_ATLAS_SIZE, 0,
+					 GL_ALPHA, GL_UNSIGNED_BYTE, page->pixels);
+
+	} else if (page->dirtyMax > page->dirtyMin) {
+		glBindTexture(GL_TEXTURE_2D, page->texture);
+
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, page->dirtyMin,
+						DEFAULT_FONT_ATLAS_SIZE, page->dirtyMax - page->dirtyMin,
+						GL_ALPHA, GL_UNSIGNED_BYTE, page->pixels + page->dirtyMin * DEFAULT_FONT_ATLAS_SIZE);
+	}
+
+	page->dirtyMin = DEFAULT_FONT_ATLAS_SIZE;
+	page->dirtyMax = 0;
+}
+
+/**
+ * @brief Converts the given rasterized glyph to 32 bit, if necessary.
+ * @return The converted surface, which may be the given surface, or `NULL` on error.
+ */
+static SDL_Surface *convertGlyph(SDL_Surface *surface) {
+
+	if (surface && surface->format->BytesPerPixel != 4) {
+		SDL_Surface *converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+		SDL_FreeSurface(surface);
+		surface = converted;
+	}
+
+	return surface;
+}
+
+/**
+ * @brief Packs the given rasterized glyph into the atlas, copying its alpha channel.
+ */
+static void storeGlyph(Font *self, FontGlyph *glyph, SDL_Surface *surface) {
+
+	if (surface && surface->w && surface->h) {
+
+		glyph->page = packGlyph(self, surface->w, surface->h, &glyph->rect);
+		if (glyph->page) {
+
+			Uint8 *pixels = self->pages[glyph->page - 1].pixels;
+
+			SDL_LockSurface(surface);
+
+			for (int y = 0; y < surface->h; y++) {
+				const Uint32 *in = (Uint32 *) ((Uint8 *) surface->pixels + y * surface->pitch);
+				Uint8 *out = pixels + (glyph->rect.y + y) * DEFAULT_FONT_ATLAS_SIZE + glyph->rect.x;
+
+				for (int x = 0; x < surface->w; x++, in++, out++) {
+					Uint8 r, g, b;
+					SDL_GetRGBA(*in, surface->format, &r, &g, &b, out);
+				}
+			}
+
+			SDL_UnlockSurface(surface);
+		}
+	}
+}
+
+/**
+ * @brief Draws the given run of glyphs, which share an atlas page, and empties it.
+ */
+static void drawGlyphRun(FontGlyphRun *run, Renderer *renderer) {
+
+	$(renderer, drawTextureRegions, run->texture, run->texcoords, run->rects, run->count);
+
+	run->count = 0;
+}
+
+#pragma mark - Glyph rasterization
+
+/**
+ * @brief Opens the given font file, serialized with the worker threads.
+ * @remarks FreeType faces share a library instance, which is not thread-safe.
+ */
+static TTF_Font *openFont(const char *path, int size, int index) {
+
+	if (_rasterizer.lock) {
+		SDL_LockMutex(_rasterizer.lock);
+	}
+
+	TTF_Font *font = TTF_OpenFontIndex(path, size, index);
+	if (font) {
+		TTF_SetFontHinting(font, TTF_HINTING_LIGHT);
+	}
+
+	if (_rasterizer.lock) {
+		SDL_UnlockMutex(_rasterizer.lock);
+	}
+
+	return font;
+}
+
+/**
+ * @brief Closes the given font, serialized with the worker threads.
+ */
+static void closeFont(TTF_Font *font) {
+
+	if (font) {
+		if (_rasterizer.lock) {
+			SDL_LockMutex(_rasterizer.lock);
+		}
+
+		TTF_CloseFont(font);
+
+		if (_rasterizer.lock) {
+			SDL_UnlockMutex(_rasterizer.lock);
+		}
+	}
+}
+
+/**
+ * @brief Frees the given list of jobs, releasing their Fonts.
+ */
+static void freeJobs(FontGlyphJob *job) {
+
+	while (job) {
+		FontGlyphJob *next = job->next;
+
+		release(job->font);
+		free(job->path);
+		SDL_FreeSurface(job->surface);
+		free(job);
+
+		job = next;
+	}
+}
+
+/**
+ * @brief The worker thread entry point.
+ * @remarks Workers hold the lock except while rasterizing.
+ */
+static int rasterizeGlyphs(void *data) {
+
+	FontHandle *handles = NULL;
+	size_t numHandles = 0;
+
+	SDL_LockMutex(_rasterizer.lock);
+
+	while (true) {
+
+		while (_rasterizer.jobs == NULL && _rasterizer.isShutdown == false) {
+			SDL_CondWait(_rasterizer.cond, _rasterizer.lock);
+		}
+
+		if (_rasterizer.isShutdown) {
+			break;
+		}
+
+		FontGlyphJob *job = _rasterizer.jobs;
+
+		_rasterizer.jobs = job->next;
+		if (_rasterizer.jobs == NULL) {
+			_rasterizer.lastJob = NULL;
+		}
+
+		TTF_Font *font = NULL;
+		for (size_t i = 0; i < numHandles; i++) {
+			const FontHandle *handle = &handles[i];
+			if (handle->size == job->size && handle->index == job->index && !strcmp(handle->path, job->path)) {
+				font = handle->font;
+				break;
+			}
+		}
+
+		if (font == NULL) {
+			font = TTF_OpenFontIndex(job->path, job->size, job->index);
+			if (font) {
+				TTF_SetFontHinting(font, TTF_HINTING_LIGHT);
+
+				handles = realloc(handles, (numHandles + 1) * sizeof(FontHandle));
+				assert(handles);
+
+				handles[numHandles++] = (FontHandle) {
+					.path = strdup(job->path),
+					.size = job->size,
+					.index = job->index,
+					.font = font
+				};
+			}
+		}
+
+		SDL_UnlockMutex(_rasterizer.lock);
+
+		if (font) {
+			job->surface = convertGlyph(TTF_RenderGlyph_Blended(font, job->character, Colors.White));
+		}
+
+		SDL_LockMutex(_rasterizer.lock);
+
+		job->next = _rasterizer.results;
+		_rasterizer.results = job;
+	}
+
+	for (size_t i = 0; i < numHandles; i++) {
+		TTF_CloseFont(handles[i].font);
+		free(handles[i].path);
+	}
+
+	SDL_UnlockMutex(_rasterizer.lock);
+
+	free(handles);
+	return 0;
+}
+
+/**
+ * @brief Starts the worker pool, if it has not yet been started.
+ * @return True if glyphs may be rasterized on worker threads.
+ */
+static _Bool startRasterizer(void) {
+
+	if (_rasterizer.isStarted == false) {
+		_rasterizer.isStarted = true;
+
+		const int numThreads = min(DEFAULT_FONT_RASTERIZER_THREADS, max(1, SDL_GetCPUCount() - 1));
+		if (numThreads > 0) {
+
+			_rasterizer.lock = SDL_CreateMutex();
+			_rasterizer.cond = SDL_CreateCond();
+
+			if (_rasterizer.lock && _rasterizer.cond) {
+				for (int i = 0; i < numThreads; i++) {
+
+					SDL_Thread *thread = SDL_CreateThread(rasterizeGlyphs, "Font", NULL);
+					if (thread == NULL) {
+						MVC_LogWarn("Failed to create glyph rasterizer: %s\n", SDL_GetError());
+						break;
+					}
+
+					_rasterizer.threads[_rasterizer.numThreads++] = thread;
+				}
+			}
+		}
+	}
+
+	return _rasterizer.numThreads > 0;
+}
+
+/**
+ * @brief Stops the worker pool, discarding any queued or finished jobs.
+ */
+static void stopRasterizer(void) {
+
+	if (_rasterizer.numThreads) {
+
+		SDL_LockMutex(_rasterizer.lock);
+
+		_rasterizer.isShutdown = true;
+		SDL_CondBroadcast(_rasterizer.cond);
+
+		SDL_UnlockMutex(_rasterizer.lock);
+
+		for (int i = 0; i < _rasterizer.numThreads; i++) {
+			SDL_WaitThread(_rasterizer.threads[i], NULL);
+		}
+	}
+
+	FontGlyphJob *jobs = _rasterizer.jobs, *results = _rasterizer.results;
+
+	if (_rasterizer.cond) {
+		SDL_DestroyCond(_rasterizer.cond);
+	}
+
+	if (_rasterizer.lock) {
+		SDL_DestroyMutex(_rasterizer.lock);
+	}
+
+	memset(&_rasterizer, 0, sizeof(_rasterizer));
+
+	freeJobs(jobs);
+	freeJobs(results);
+}
+
+/**
+ * @brief Queues the given glyph for rasterization on a worker thread.
+ * @return True if the glyph was queued, false if it must be rasterized synchronously.
+ */
+static _Bool queueGlyph(Font *self, FontGlyph *glyph, Uint16 character) {
+
+	if (self->path == NULL || startRasterizer() == false) {
+		return false;
+	}
+
+	FontGlyphJob *job = calloc(1, sizeof(FontGlyphJob));
+	assert(job);
+
+	job->font = retain(self);
+	job->character = character;
+	job->path = strdup(self->path);
+	job->size = self->pointSize;
+	job->index = self->faceIndex;
+
+	glyph->isPending = true;
+
+	SDL_LockMutex(_rasterizer.lock);
+
+	if (_rasterizer.lastJob) {
+		_rasterizer.lastJob->next = job;
+	} else {
+		_rasterizer.jobs = job;
+	}
+
+	_rasterizer.lastJob = job;
+
+	SDL_CondSignal(_rasterizer.cond);
+	SDL_UnlockMutex(_rasterizer.lock);
+
+	return true;
+}
+
+#pragma mark - Measurement cache
+
+/**
+ * @brief Empties the given measurement cache.
+ */
+static void clearMeasurements(struct FontMeasurementCache *cache) {
+
+	for (int i = 0; i < cache->count; i++) {
+		free(cache->entries[i].chars);
+	}
+
+	for (size_t i = 0; i < lengthof(cache->buckets); i++) {
+		cache->buckets[i] = -1;
+	}
+
+	cache->count = 0;
+	cache->head = cache->tail = -1;
+}
+
+/**
+ * @brief Removes the given entry from the recently used list.
+ */
+static void unlinkMeasurement(struct FontMeasurementCache *cache, int index) {
+
+	FontMeasurement *entry = &cache->entries[index];
+
+	if (entry->prev == -1) {
+		cache->head = entry->next;
+	} else {
+		cache->entries[entry->prev].next = entry->next;
+	}
+
+	if (entry->next == -1) {
+		cache->tail = entry->prev;
+	} else {
+		cache->entries[entry->next].prev = entry->prev;
+	}
+}
+
+/**
+ * @brief Inserts the given entry at the head of the recently used list.
+ */
+static void linkMeasurement(struct FontMeasurementCache *cache, int index) {
+
+	FontMeasurement *entry = &cache->entries[index];
+
+	entry->prev = -1;
+	entry->next = cache->head;
+
+	if (cache->head == -1) {
+		cache->tail = index;
+	} else {
+		cache->entries[cache->head].prev = index;
+	}
+
+	cache->head = index;
+}
+
+/**
+ * @brief Resolves the measurement of the given characters, measuring them if necessary.
+ * @remarks When the cache is full, the least recently used measurement is evicted.
+ */
+static const FontMeasurement *measureCharacters(const Font *self, const char *chars) {
+
+	struct FontMeasurementCache *cache = self->measurements;
+
+	Uint32 hash = 2166136261u;
+	for (const unsigned char *c = (const unsigned char *) chars; *c; c++) {
+		hash = (hash ^ *c) * 16777619u;
+	}
+
+	int *bucket = &cache->buckets[hash % lengthof(cache->buckets)];
+
+	for (int i = *bucket; i != -1; i = cache->entries[i].bucketNext) {
+		FontMeasurement *entry = &cache->entries[i];
+		if (entry->hash == hash && strcmp(entry->chars, chars) == 0) {
+			if (cache->head != i) {
+				unlinkMeasurement(cache, i);
+				linkMeasurement(cache, i);
+			}
+			return entry;
+		}
+	}
+
+	int index;
+	if (cache->count < (int) lengthof(cache->entries)) {
+		index = cache->count++;
+	} else {
+		index = cache->tail;
+
+		FontMeasurement *evicted = &cache->entries[index];
+
+		int *link = &cache->buckets[evicted->hash % lengthof(cache->buckets)];
+		while (*link != index) {
+			link = &cache->entries[*link].bucketNext;
+		}
+		*link = evicted->bucketNext;
+
+		unlinkMeasurement(cache, index);
+		free(evicted->chars);
+	}
+
+	FontMeasurement *entry = &cache->entries[index];
+
+	entry->hash = hash;
+	entry->chars = strdup(chars);
+	assert(entry->chars);
+
+	TTF_SizeUTF8(self->font, chars, &entry->w, &entry->h);
+
+	entry->w /= self->scale;
+	entry->h /= self->scale;
+
+	entry->bucketNext = *bucket;
+	*bucket = index;
+
+	linkMeasurement(cache, index);
+
+	return entry;
+}
+
+#pragma mark - Font resolution cache
+
+/**
+ * @brief Initializes Fontconfig, which is deferred until a font must be matched.
+ */
+static void initFontconfig(void) {
+
+	if (_fontconfig == false) {
+		const FcBool res = FcInit();
+		assert(res == FcTrue);
+
+		_fontconfig = true;
+	}
+}
+
+/**
+ * @return The path of the font resolution cache file, which must be freed.
+ */
+static char *resolutionCachePath(void) {
+
+	char *dir = SDL_GetPrefPath("ObjectivelyMVC", "ObjectivelyMVC");
+	if (dir == NULL) {
+		return NULL;
+	}
+
+	const size_t len = strlen(dir) + strlen(DEFAULT_FONT_RESOLUTION_CACHE) + 1;
+
+	char *path = malloc(len);
+	assert(path);
+
+	snprintf(path, len, "%s%s", dir, DEFAULT_FONT_RESOLUTION_CACHE);
+	SDL_free(dir);
+
+	return path;
+}
+
+/**
+ * @brief Adds the given resolution to the cache.
+ */
+static FontResolution *addResolution(const char *key, const char *path, double size, int index) {
+
+	_resolutions.entries = realloc(_resolutions.entries, (_resolutions.count + 1) * sizeof(FontResolution));
+	assert(_resolutions.entries);
+
+	FontResolution *resolution = &_resolutions.entries[_resolutions.count++];
+
+	resolution->key = strdup(key);
+	resolution->path = strdup(path);
+	assert(resolution->key && resolution->path);
+
+	resolution->size = size;
+	resolution->index = index;
+
+	return resolution;
+}
+
+/**
+ * @brief Removes all resolutions from the cache.
+ */
+static void clearResolutions(void) {
+
+	for (size_t i = 0; i < _resolutions.count; i++) {
+		free(_resolutions.entries[i].key);
+		free(_resolutions.entries[i].path);
+	}
+
+	free(_resolutions.entries);
+
+	_resolutions.entries = NULL;
+	_resolutions.count = 0;
+}
+
+/**
+ * @brief Reads the font resolution cache file.
+ * @details The file begins with the Fontconfig version, followed by the modification time of
+ * each of Fontconfig's configuration files and font directories when the file was written. If
+ * any of these differ, the file is stale, and is ignored.
+ */
+static void loadResolutions(void) {
+
+	_resolutions.isLoaded = true;
+
+	char *path = resolutionCachePath();
+	if (path == NULL) {
+		return;
+	}
+
+	FILE *file = fopen(path, "r");
+	free(path);
+
+	if (file == NULL) {
+		return;
+	}
+
+	_Bool isValid = false;
+
+	char line[4096];
+	while (fgets(line, sizeof(line), file)) {
+
+		line[strcspn(line, "\n")] = '\0';
+
+		char *fields[5];
+		size_t numFields = 0;
+
+		for (char *field = strtok(line, "\t"); field && numFields < lengthof(fields); field = strtok(NULL, "\t")) {
+			fields[numFields++] = field;
+		}
+
+		if (numFields == 2 && strcmp(fields[0], "V") == 0) {
+			isValid = strtol(fields[1], NULL, 10) == FcGetVersion();
+		} else if (numFields == 3 && strcmp(fields[0], "T") == 0) {
+			struct stat st;
+			if (stat(fields[2], &st) || (long long) st.st_mtime != strtoll(fields[1], NULL, 10)) {
+				isValid = false;
+			}
+		} else if (numFields == 5 && strcmp(fields[0], "F") == 0) {
+			if (isValid) {
+				addResolution(fields[1], fields[2], strtod(fields[3], NULL), (int) strtol(fields[4], NULL, 10));
+			}
+		} else {
+			isValid = false;
+		}
+
+		if (isValid == false) {
+			break;
+		}
+	}
+
+	fclose(file);
+
+	if (isValid == false) {
+		MVC_LogDebug("Discarding stale font resolution cache\n");
+		clearResolutions();
+	}
+}
+
+/**
+ * @brief Writes the modification time of each of the given paths to the given file.
+ */
+static void saveResolutions_timestamps(FILE *file, FcStrList *list) {
+
+	if (list) {
+		FcChar8 *path;
+		while ((path = FcStrListNext(list))) {
+			struct stat st;
+			if (stat((char *) path, &st) == 0) {
+				fprintf(file, "T\t%lld\t%s\n", (long long) st.st_mtime, (char *) path);
+			}
+		}
+		FcStrListDone(list);
+	}
+}
+
+/**
+ * @brief Writes the font resolution cache file, if resolutions have been added.
+ * @details The file is written to a temporary file, which then replaces it, so that other
+ * processes sharing the file never read it partially written.
+ */
+static void saveResolutions(void) {
+
+	if (_resolutions.isDirty == false) {
+		return;
+	}
+
+	_resolutions.isDirty = false;
+
+	char *path = resolutionCachePath();
+	if (path == NULL) {
+		return;
+	}
+
+	char temp[PATH_MAX];
+	snprintf(temp, sizeof(temp), "%s.%d", path, (int) getpid());
+
+	FILE *file = fopen(temp, "w");
+	if (file == NULL) {
+		MVC_LogWarn("Failed to write %s\n", temp);
+		free(path);
+		return;
+	}
+
+	fprintf(file, "V\t%d\n", FcGetVersion());
+
+	saveResolutions_timestamps(file, FcConfigGetConfigFiles(NULL));
+	saveResolutions_timestamps(file, FcConfigGetFontDirs(NULL));
+
+	for (size_t i = 0; i < _resolutions.count; i++) {
+		const FontResolution *resolution = &_resolutions.entries[i];
+		fprintf(file, "F\t%s\t%s\t%g\t%d\n", resolution->key, resolution->path, resolution->size, resolution->index);
+	}
+
+	if (fclose(file) || rename(temp, path)) {
+		MVC_LogWarn("Failed to write %s\n", path);
+		remove(temp);
+	}
+
+	free(path);
+}
 
 /**
- * @see Object::dealloc(Object *)
+ * @brief Resolves the given search pattern to a font file, from the cache or by matching it.
+ * @param search The search pattern.
+ * @param useCache False to disregard, and replace, any cached resolution.
+ * @return The resolution, or `NULL` if no font matches the pattern.
  */
-static void dealloc(Object *self) {
+static const FontResolution *resolvePattern(FcPattern *search, _Bool useCache) {
 
-	Font *this = (Font *) self;
+	if (_resolutions.isLoaded == false) {
+		loadResolutions();
+	}
 
-	if (this->font) {
-		TTF_CloseFont(this->font);
+	FcChar8 *key = FcNameUnparse(search);
+	assert(key);
+
+	for (size_t i = 0; i < _resolutions.count; i++) {
+		FontResolution *resolution = &_resolutions.entries[i];
+		if (strcmp(resolution->key, (char *) key) == 0) {
+			if (useCache) {
+				free(key);
+				return resolution;
+			}
+
+			free(resolution->key);
+			free(resolution->path);
+
+			*resolution = _resolutions.entries[--_resolutions.count];
+			break;
+		}
 	}
 
-	FcStrFree((FcChar8 *) this->name);
+	const Uint32 start = SDL_GetTicks();
 
-	super(Object, self, dealloc);
+	initFontconfig();
+
+	const FontResolution *resolution = NULL;
+
+	FcPattern *pattern = FcPatternDuplicate(search);
+	assert(pattern);
+
+	FcConfigSubstitute(NULL, pattern, FcMatchFont);
+	FcDefaultSubstitute(pattern);
+
+	FcResult result;
+	FcPattern *match = FcFontMatch(NULL, pattern, &result);
+
+	if (result == FcResultMatch) {
+
+		FcChar8 *path;
+		if (FcPatternGetString(match, FC_FILE, 0, &path) == FcResultMatch) {
+
+			double size;
+			if (FcPatternGetDouble(match, FC_SIZE, 0, &size) == FcResultMatch) {
+
+				int index;
+				if (FcPatternGetInteger(match, FC_INDEX, 0, &index) == FcResultMatch) {
+
+					resolution = addResolution((char *) key, (char *) path, size, index);
+
+					_resolutions.isDirty = true;
+				}
+			}
+		}
+	}
+
+	FcPatternDestroy(pattern);
+	FcPatternDestroy(match);
+
+	MVC_LogDebug("Resolved %s in %ums\n", (char *) key, SDL_GetTicks() - start);
+
+	free(key);
+
+	return resolution;
+}
+
+#pragma mark - Font cache
+
+static MutableDictionary *_cache;
+static FontCacheStatistics _cacheStatistics;
+
+/**
+ * @brief Creates a Fontconfig pattern with the given attributes.
+ */
+static FcPattern *patternWithAttributes(const char *family, int size, int style) {
+
+	FcPattern *pattern = FcPatternCreate();
+	assert(pattern);
+
+	FcPatternAddString(pattern, FC_FAMILY, (FcChar8 *) family);
+
+	FcPatternAddDouble(pattern, FC_SIZE, (double) size);
+
+	if (style & TTF_STYLE_BOLD) {
+		if (style & TTF_STYLE_ITALIC) {
+			FcPatternAddString(pattern, FC_STYLE, (FcChar8 *) "Bold Italic");
+		} else {
+			FcPatternAddString(pattern, FC_STYLE, (FcChar8 *) "Bold");
+		}
+	} else if (style & TTF_STYLE_ITALIC) {
+		FcPatternAddString(pattern, FC_STYLE, (FcChar8 *) "Italic");
+	} else {
+		FcPatternAddString(pattern, FC_STYLE, (FcChar8 *) "Regular");
+	}
+
+	return pattern;
+}
+
+/**
+ * @brief Resolves the shared Font for the given Fontconfig pattern, loading it if necessary.
+ * @return A retained Font, or `NULL` on error.
+ */
+static Font *cachedFontWithPattern(FcPattern *pattern) {
+
+	FcChar8 *name = FcNameUnparse(pattern);
+	assert(name);
+
+	String *key = $$(String, stringWithCharacters, (char *) name);
+	assert(key);
+
+	free(name);
+
+	Font *font = $((Dictionary *) _cache, objectForKey, key);
+	if (font) {
+		_cacheStatistics.hits++;
+		retain(font);
+	} else {
+		_cacheStatistics.misses++;
+
+		font = $(alloc(Font), initWithPattern, pattern);
+		if (font) {
+			font->isCached = true;
+
+			$(_cache, setObjectForKey, font, key);
+			_cacheStatistics.count++;
+		}
+	}
+
+	release(key);
+
+	return font;
 }
 
 #pragma mark - Font
@@ -67,6 +1193,8 @@ static Order allFonts_sort(const ident a, const ident b) {
  */
 static Array *allFonts(void) {
 
+	initFontconfig();
+
 	MutableArray *fonts = $$(MutableArray, array);
 
 	FcPattern *pattern = FcPatternCreate();
@@ -96,6 +1224,48 @@ static Array *allFonts(void) {
 	return (Array *) fonts;
 }
 
+/**
+ * @fn FontCacheStatistics Font::cacheStatistics(void)
+ * @memberof Font
+ */
+static FontCacheStatistics cacheStatistics(void) {
+	return _cacheStatistics;
+}
+
+/**
+ * @fn Font *Font::cachedFontWithAttributes(const char *family, int size, int style)
+ * @memberof Font
+ */
+static Font *cachedFontWithAttributes(const char *family, int size, int style) {
+
+	FcPattern *pattern = patternWithAttributes(family, size, style);
+
+	Font *font = cachedFontWithPattern(pattern);
+
+	FcPatternDestroy(pattern);
+
+	return font;
+}
+
+/**
+ * @fn Font *Font::cachedFontWithName(const char *name)
+ * @memberof Font
+ */
+static Font *cachedFontWithName(const char *name) {
+
+	Font *font = NULL;
+
+	FcPattern *pattern = FcNameParse((FcChar8 *) name);
+	if (pattern) {
+
+		font = cachedFontWithPattern(pattern);
+
+		FcPatternDestroy(pattern);
+	}
+
+	return font;
+}
+
 static Font *_normal;
 static Font *_smaller;
 static Font *_bigger;
@@ -109,13 +1279,13 @@ static Font *defaultFont(FontCategory category) {
 	static Once once;
 
 	do_once(&once, {
-		_normal = $(alloc(Font), initWithAttributes, DEFAULT_FONT_FAMILY, 14, 0);
+		_normal = $$(Font, cachedFontWithAttributes, DEFAULT_FONT_FAMILY, 14, 0);
 		assert(_normal);
 
-		_smaller = $(alloc(Font), initWithAttributes, DEFAULT_FONT_FAMILY, 12, 0);
+		_smaller = $$(Font, cachedFontWithAttributes, DEFAULT_FONT_FAMILY, 12, 0);
 		assert(_smaller);
 
-		_bigger = $(alloc(Font), initWithAttributes, DEFAULT_FONT_FAMILY, 16, 0);
+		_bigger = $$(Font, cachedFontWithAttributes, DEFAULT_FONT_FAMILY, 16, 0);
 		assert(_bigger);
 	});
 
@@ -134,29 +1304,123 @@ static Font *defaultFont(FontCategory category) {
 }
 
 /**
- * @fn Font *Font::initWithAttributes(Font *self, const char *family, int size, int style)
+ * @fn _Bool Font::drawCharacters(Font *self, const char *chars, Renderer *renderer, const SDL_Point *origin)
  * @memberof Font
  */
-static Font *initWithAttributes(Font *self, const char *family, int size, int style) {
+static _Bool drawCharacters(Font *self, const char *chars, Renderer *renderer, const SDL_Point *origin) {
 
-	FcPattern *pattern = FcPatternCreate();
-	assert(pattern);
+	assert(chars);
+	assert(renderer);
+	assert(origin);
 
-	FcPatternAddString(pattern, FC_FAMILY, (FcChar8 *) family);
+	const double scale = self->scale;
+	const int ascent = TTF_FontAscent(self->font);
+	const _Bool kerning = TTF_GetFontKerning(self->font);
 
-	FcPatternAddDouble(pattern, FC_SIZE, (double) size);
+	FontGlyphRun run = { .count = 0 };
 
-	if (style & TTF_STYLE_BOLD) {
-		if (style & TTF_STYLE_ITALIC) {
-			FcPatternAddString(pattern, FC_STYLE, (FcChar8 *) "Bold Italic");
-		} else {
-			FcPatternAddString(pattern, FC_STYLE, (FcChar8 *) "Bold");
+	int x = 0;
+	Uint16 previous = 0;
+	_Bool isComplete = true;
+
+	while (*chars) {
+
+		const Uint16 character = decodeCharacter(&chars);
+
+		const FontGlyph *glyph = $(self, glyphForCharacter, character);
+		if (glyph == NULL) {
+			continue;
 		}
-	} else if (style & TTF_STYLE_ITALIC) {
-		FcPatternAddString(pattern, FC_STYLE, (FcChar8 *) "Italic");
-	} else {
-		FcPatternAddString(pattern, FC_STYLE, (FcChar8 *) "Regular");
-	};
+
+		if (kerning && previous) {
+			x += TTF_GetFontKerningSizeGlyphs(self->font, previous, character);
+		}
+
+		if (glyph->isPending) {
+			isComplete = false;
+		} else if (glyph->page) {
+			FontAtlasPage *page = &self->pages[glyph->page - 1];
+			if (page->texture == 0 || page->dirtyMax > page->dirtyMin) {
+				uploadPage(page);
+			}
+
+			if (run.count && (run.texture != page->texture || run.count == lengthof(run.rects))) {
+				drawGlyphRun(&run, renderer);
+			}
+
+			run.texture = page->texture;
+
+			GLfloat *texcoords = &run.texcoords[run.count * 4];
+
+			texcoords[0] = glyph->rect.x / (GLfloat) DEFAULT_FONT_ATLAS_SIZE;
+			texcoords[1] = glyph->rect.y / (GLfloat) DEFAULT_FONT_ATLAS_SIZE;
+			texcoords[2] = (glyph->rect.x + glyph->rect.w) / (GLfloat) DEFAULT_FONT_ATLAS_SIZE;
+			texcoords[3] = (glyph->rect.y + glyph->rect.h) / (GLfloat) DEFAULT_FONT_ATLAS_SIZE;
+
+			const int x0 = round((x + glyph->minx) / scale), x1 = round((x + glyph->minx + glyph->rect.w) / scale);
+			const int y0 = round((ascent - glyph->maxy) / scale), y1 = round((ascent - glyph->maxy + glyph->rect.h) / scale);
+
+			run.rects[run.count++] = MakeRect(origin->x + x0, origin->y + y0, x1 - x0, y1 - y0);
+		}
+
+		x += glyph->advance;
+		previous = character;
+	}
+
+	if (run.count) {
+		drawGlyphRun(&run, renderer);
+	}
+
+	return isComplete;
+}
+
+/**
+ * @fn const FontGlyph *Font::glyphForCharacter(Font *self, Uint16 character)
+ * @memberof Font
+ */
+static const FontGlyph *glyphForCharacter(Font *self, Uint16 character) {
+
+	FontGlyph **row = &self->glyphs[character >> 8];
+	if (*row == NULL) {
+		*row = calloc(0x100, sizeof(FontGlyph));
+		assert(*row);
+	}
+
+	FontGlyph *glyph = &(*row)[character & 0xff];
+	if (glyph->isCached) {
+		return glyph;
+	}
+
+	int minx, maxx, miny, maxy, advance;
+	if (TTF_GlyphMetrics(self->font, character, &minx, &maxx, &miny, &maxy, &advance)) {
+		return NULL;
+	}
+
+	glyph->isCached = true;
+
+	glyph->minx = minx;
+	glyph->maxy = maxy;
+	glyph->advance = advance;
+
+	if (queueGlyph(self, glyph, character) == false) {
+
+		SDL_Surface *surface = convertGlyph(TTF_RenderGlyph_Blended(self->font, character, Colors.White));
+
+		storeGlyph(self, glyph, surface);
+
+		SDL_FreeSurface(surface);
+	}
+
+	return glyph;
+}
+
+/**
+ * @fn Font *Font::initWithAttributes(Font *self, const char *family, int size, int style)
+ * @memberof Font
+ */
+static Font *initWithAttributes(Font *self, const char *family, int size, int style) {
+
+	FcPattern *pattern = patternWithAttributes(family, size, style);
 
 	self = $(self, initWithPattern, pattern);
 
@@ -193,6 +1457,17 @@ static Font *initWithPattern(Font *self, ident pattern) {
 
 		assert(pattern);
 
+		self->scale = MVC_WindowScale(NULL, NULL, NULL);
+
+		if (self->measurements == NULL) {
+			self->measurements = malloc(sizeof(struct FontMeasurementCache));
+			assert(self->measurements);
+
+			self->measurements->count = 0;
+		}
+
+		clearMeasurements(self->measurements);
+
 		FcPattern *search = FcPatternDuplicate(pattern);
 		assert(search);
 
@@ -203,41 +1478,34 @@ static Font *initWithPattern(Font *self, ident pattern) {
 
 			FcPatternDel(search, FC_SIZE);
 
-			const double windowScale = MVC_WindowScale(NULL, NULL, NULL);
-			FcPatternAddDouble(search, FC_SIZE, requestedSize * windowScale);
+			FcPatternAddDouble(search, FC_SIZE, requestedSize * self->scale);
 		}
 
-		FcConfigSubstitute(NULL, search, FcMatchFont);
-		FcDefaultSubstitute(search);
-
-		FcResult result;
-		FcPattern *match = FcFontMatch(NULL, search, &result);
-
-		if (result == FcResultMatch) {
-
-			FcChar8 *path;
-			if (FcPatternGetString(match, FC_FILE, 0, &path) == FcResultMatch) {
+		for (int attempt = 0; attempt < 2 && self->font == NULL; attempt++) {
 
-				double size;
-				if (FcPatternGetDouble(match, FC_SIZE, 0, &size) == FcResultMatch) {
+			const FontResolution *resolution = resolvePattern(search, attempt == 0);
+			if (resolution == NULL) {
+				break;
+			}
 
-					int index;
-					if (FcPatternGetInteger(match, FC_INDEX, 0, &index) == FcResultMatch) {
+			self->font = openFont(resolution->path, (int) resolution->size, resolution->index);
+			if (self->font) {
+				free(self->path);
 
-						self->font = TTF_OpenFontIndex((char *) path, (int) size, index);
-						if (self->font) {
-							TTF_SetFontHinting(self->font, TTF_HINTING_LIGHT);
+				self->path = strdup(resolution->path);
+				assert(self->path);
 
-							self->name = (char *) FcNameUnparse(pattern);
-							assert(self->name);
-						}
-					}
-				}
+				self->pointSize = (int) resolution->size;
+				self->faceIndex = resolution->index;
 			}
 		}
 
+		if (self->font) {
+			self->name = (char *) FcNameUnparse(pattern);
+			assert(self->name);
+		}
+
 		FcPatternDestroy(search);
-		FcPatternDestroy(match);
 
 		if (self->font == NULL) {
 			FcChar8 *name = FcNameUnparse(pattern);
@@ -266,11 +1534,56 @@ static SDL_Surface *renderCharacters(const Font *self, const char *chars, SDL_Co
  */
 static void renderDeviceDidReset(Font *self) {
 
+	for (size_t i = 0; i < self->numPages; i++) {
+		self->pages[i].texture = 0;
+	}
+
+	if (MVC_WindowScale(NULL, NULL, NULL) == self->scale) {
+		return;
+	}
+
+	closeFont(self->font);
+	self->font = NULL;
+
+	for (size_t i = 0; i < self->numPages; i++) {
+		free(self->pages[i].pixels);
+	}
+
+	free(self->pages);
+	self->pages = NULL;
+	self->numPages = 0;
+
+	for (size_t i = 0; i < lengthof(self->glyphs); i++) {
+		free(self->glyphs[i]);
+		self->glyphs[i] = NULL;
+	}
+
+	clearMeasurements(self->measurements);
+
 	char *name = self->name;
+	self->name = NULL;
 
 	$(self, initWithName, name);
 
-	release(name);
+	FcStrFree((FcChar8 *) name);
+}
+
+/**
+ * @brief DictionaryEnumerator for renderDeviceDidResetFonts.
+ */
+static void renderDeviceDidResetFonts_enumerate(const Dictionary *dictionary, ident obj, ident key, ident data) {
+	$((Font *) obj, renderDeviceDidReset);
+}
+
+/**
+ * @fn void Font::renderDeviceDidResetFonts(void)
+ * @memberof Font
+ */
+static void renderDeviceDidResetFonts(void) {
+
+	if (_cache) {
+		$((Dictionary *) _cache, enumerateObjectsAndKeys, renderDeviceDidResetFonts_enumerate, NULL);
+	}
 }
 
 /**
@@ -279,15 +1592,90 @@ static void renderDeviceDidReset(Font *self) {
  */
 static void sizeCharacters(const Font *self, const char *chars, int *w, int *h) {
 
-	TTF_SizeUTF8(self->font, chars, w, h);
+	const FontMeasurement *measurement = measureCharacters(self, chars);
 
-	const float scale = MVC_WindowScale(NULL, NULL, NULL);
 	if (w) {
-		*w /= scale;
+		*w = measurement->w;
 	}
 	if (h) {
-		*h /= scale;
+		*h = measurement->h;
+	}
+}
+
+/**
+ * @fn void Font::uploadGlyphs(void)
+ * @memberof Font
+ */
+static void uploadGlyphs(void) {
+
+	if (_rasterizer.numThreads == 0) {
+		return;
+	}
+
+	SDL_LockMutex(_rasterizer.lock);
+
+	FontGlyphJob *results = _rasterizer.results;
+	_rasterizer.results = NULL;
+
+	SDL_UnlockMutex(_rasterizer.lock);
+
+	for (FontGlyphJob *job = results; job; job = job->next) {
+
+		Font *font = job->font;
+
+		if (font->glyphs[job->character >> 8] == NULL || job->size != font->pointSize ||
+			job->index != font->faceIndex || strcmp(job->path, font->path)) {
+			continue;
+		}
+
+		FontGlyph *glyph = &font->glyphs[job->character >> 8][job->character & 0xff];
+		if (glyph->isPending == false) {
+			continue;
+		}
+
+		storeGlyph(font, glyph, job->surface);
+		glyph->isPending = false;
+
+		if (glyph->page) {
+			uploadPage(&font->pages[glyph->page - 1]);
+		}
+	}
+
+	freeJobs(results);
+}
+
+/**
+ * @fn int Font::widthOfPrefix(Font *self, const char *chars, size_t length)
+ * @memberof Font
+ */
+static int widthOfPrefix(Font *self, const char *chars, size_t length) {
+
+	assert(chars);
+
+	const char *end = chars + length;
+	const _Bool kerning = TTF_GetFontKerning(self->font);
+
+	int x = 0;
+	Uint16 previous = 0;
+
+	while (*chars && chars < end) {
+
+		const Uint16 character = decodeCharacter(&chars);
+
+		const FontGlyph *glyph = $(self, glyphForCharacter, character);
+		if (glyph == NULL) {
+			continue;
+		}
+
+		if (kerning && previous) {
+			x += TTF_GetFontKerningSizeGlyphs(self->font, previous, character);
+		}
+
+		x += glyph->advance;
+		previous = character;
 	}
+
+	return round(x / self->scale);
 }
 
 #pragma mark - Class lifecycle
@@ -300,19 +1688,27 @@ static void initialize(Class *clazz) {
 	((ObjectInterface *) clazz->def->interface)->dealloc = dealloc;
 
 	((FontInterface *) clazz->def->interface)->allFonts = allFonts;
+	((FontInterface *) clazz->def->interface)->cacheStatistics = cacheStatistics;
+	((FontInterface *) clazz->def->interface)->cachedFontWithAttributes = cachedFontWithAttributes;
+	((FontInterface *) clazz->def->interface)->cachedFontWithName = cachedFontWithName;
 	((FontInterface *) clazz->def->interface)->defaultFont = defaultFont;
+	((FontInterface *) clazz->def->interface)->drawCharacters = drawCharacters;
+	((FontInterface *) clazz->def->interface)->glyphForCharacter = glyphForCharacter;
 	((FontInterface *) clazz->def->interface)->initWithAttributes = initWithAttributes;
 	((FontInterface *) clazz->def->interface)->initWithName = initWithName;
 	((FontInterface *) clazz->def->interface)->initWithPattern = initWithPattern;
 	((FontInterface *) clazz->def->interface)->renderCharacters = renderCharacters;
 	((FontInterface *) clazz->def->interface)->renderDeviceDidReset = renderDeviceDidReset;
+	((FontInterface *) clazz->def->interface)->renderDeviceDidResetFonts = renderDeviceDidResetFonts;
 	((FontInterface *) clazz->def->interface)->sizeCharacters = sizeCharacters;
-
-	const FcBool res = FcInit();
-	assert(res == FcTrue);
+	((FontInterface *) clazz->def->interface)->uploadGlyphs = uploadGlyphs;
+	((FontInterface *) clazz->def->interface)->widthOfPrefix = widthOfPrefix;
 
 	const int err = TTF_Init();
 	assert(err == 0);
+
+	_cache = $$(MutableDictionary, dictionary);
+	assert(_cache);
 }
 
 /**
@@ -320,11 +1716,21 @@ static void initialize(Class *clazz) {
  */
 static void destroy(Class *clazz) {
 
+	stopRasterizer();
+
 	release(_normal);
 	release(_smaller);
 	release(_bigger);
 
-	FcFini();
+	release(_cache);
+
+	saveResolutions();
+	clearResolutions();
+
+	if (_fontconfig) {
+		FcFini();
+	}
+
 	TTF_Quit();
 }
 
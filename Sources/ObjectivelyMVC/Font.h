@@ -27,6 +27,7 @@
 
 #include <Objectively/Array.h>
 
+#include <ObjectivelyMVC/Renderer.h>
 #include <ObjectivelyMVC/Types.h>
 
 #if defined(__APPLE__)
@@ -42,6 +43,11 @@
  * @brief TrueType fonts.
  */
 
+#define DEFAULT_FONT_ATLAS_SIZE 512
+#define DEFAULT_FONT_MEASUREMENT_CACHE_SIZE 256
+#define DEFAULT_FONT_RESOLUTION_CACHE "fonts.cache"
+#define DEFAULT_FONT_RASTERIZER_THREADS 2
+
 /**
  * @brief Font categories.
  */
@@ -55,6 +61,99 @@ typedef enum {
 	FontCategorySecondaryResponder
 } FontCategory;
 
+/**
+ * @brief A glyph, rasterized into a Font's atlas.
+ */
+typedef struct {
+
+	/**
+	 * @brief True if this glyph has been resolved.
+	 */
+	_Bool isCached;
+
+	/**
+	 * @brief True if this glyph is being rasterized on a worker thread, and is not yet drawable.
+	 */
+	_Bool isPending;
+
+	/**
+	 * @brief The atlas page index plus one, or `0` if this glyph has no pixels (e.g. space).
+	 */
+	size_t page;
+
+	/**
+	 * @brief The region of the atlas page occupied by this glyph, in pixels.
+	 */
+	SDL_Rect rect;
+
+	/**
+	 * @brief The horizontal bearing, in pixels.
+	 */
+	int minx;
+
+	/**
+	 * @brief The vertical bearing, in pixels.
+	 */
+	int maxy;
+
+	/**
+	 * @brief The horizontal advance, in pixels.
+	 */
+	int advance;
+} FontGlyph;
+
+/**
+ * @brief A page of a Font's glyph atlas, shelf-packed with 8 bit alpha glyphs.
+ */
+typedef struct {
+
+	/**
+	 * @brief The pixels, retained so that the texture may be updated and restored.
+	 */
+	Uint8 *pixels;
+
+	/**
+	 * @brief The texture, or `0` if the page has not been uploaded.
+	 */
+	GLuint texture;
+
+	/**
+	 * @brief The packing position within the current shelf.
+	 */
+	int x, y;
+
+	/**
+	 * @brief The height of the current shelf.
+	 */
+	int shelfHeight;
+
+	/**
+	 * @brief The range of rows that must be uploaded before the page is drawn.
+	 */
+	int dirtyMin, dirtyMax;
+} FontAtlasPage;
+
+/**
+ * @brief Statistics of the shared Font cache.
+ */
+typedef struct {
+
+	/**
+	 * @brief The count of lookups satisfied by the cache.
+	 */
+	size_t hits;
+
+	/**
+	 * @brief The count of lookups which loaded a Font.
+	 */
+	size_t misses;
+
+	/**
+	 * @brief The count of cached Fonts.
+	 */
+	size_t count;
+} FontCacheStatistics;
+
 typedef struct Font Font;
 typedef struct FontInterface FontInterface;
 
@@ -80,10 +179,64 @@ struct Font {
 	 */
 	TTF_Font *font;
 
+	/**
+	 * @brief The cache of recent measurements, in least recently used order.
+	 * @private
+	 */
+	struct FontMeasurementCache *measurements;
+
 	/**
 	 * @brief The TrueType font name, according to Fontconfig.
 	 */
 	char *name;
+
+	/**
+	 * @brief The glyph atlas pages.
+	 * @private
+	 */
+	FontAtlasPage *pages;
+
+	/**
+	 * @brief The count of glyph atlas pages.
+	 * @private
+	 */
+	size_t numPages;
+
+	/**
+	 * @brief The path of the font file, from which worker threads open their own handles.
+	 * @private
+	 */
+	char *path;
+
+	/**
+	 * @brief The point size at which the font file was opened.
+	 * @private
+	 */
+	int pointSize;
+
+	/**
+	 * @brief The face index within the font file.
+	 * @private
+	 */
+	int faceIndex;
+
+	/**
+	 * @brief The window scale with which this Font was loaded.
+	 * @private
+	 */
+	double scale;
+
+	/**
+	 * @brief True if this Font is shared through the Font cache.
+	 * @private
+	 */
+	_Bool isCached;
+
+	/**
+	 * @brief The glyphs, lazily allocated in rows of 256 and indexed by character.
+	 * @private
+	 */
+	FontGlyph *glyphs[0x100];
 };
 
 /**
@@ -104,15 +257,76 @@ struct FontInterface {
 	 */
 	Array *(*allFonts)(void);
 
+	/**
+	 * @static
+	 * @fn FontCacheStatistics Font::cacheStatistics(void)
+	 * @return The statistics of the shared Font cache.
+	 * @memberof Font
+	 */
+	FontCacheStatistics (*cacheStatistics)(void);
+
+	/**
+	 * @static
+	 * @fn Font *Font::cachedFontWithAttributes(const char *family, int size, int style)
+	 * @param family The font family.
+	 * @param size The point size.
+	 * @param style The style (e.g. `TTF_STYLE_BOLD`).
+	 * @return A retained, shared Font with the given attributes, or `NULL` on error.
+	 * @see Font::cachedFontWithName(const char *)
+	 * @memberof Font
+	 */
+	Font *(*cachedFontWithAttributes)(const char *family, int size, int style);
+
+	/**
+	 * @static
+	 * @fn Font *Font::cachedFontWithName(const char *name)
+	 * @param name The Fontconfig name.
+	 * @return A retained, shared Font with the given name, or `NULL` on error.
+	 * @remarks Fonts are cached for the life of the process, keyed by their normalized Fontconfig
+	 * pattern, so that Views which request the same Font share a single TTF_Font and glyph atlas.
+	 * Cached Fonts follow the window scale through Font::renderDeviceDidResetFonts.
+	 * @memberof Font
+	 */
+	Font *(*cachedFontWithName)(const char *name);
+
 	/**
 	 * @static
 	 * @fn Font *Font::defaultFont(FontCategory category)
 	 * @param category The FontCategory.
 	 * @return The default Font for the given category.
+	 * @remarks The default Fonts are resolved through the shared Font cache.
 	 * @memberof Font
 	 */
 	Font *(*defaultFont)(FontCategory category);
 
+	/**
+	 * @fn _Bool Font::drawCharacters(Font *self, const char *chars, Renderer *renderer, const SDL_Point *origin)
+	 * @brief Draws the given characters from this Font's glyph atlas, in the current draw color.
+	 * @param self The Font.
+	 * @param chars The null-terminated UTF-8 encoded C string to draw.
+	 * @param renderer The Renderer.
+	 * @param origin The top-left origin of the characters, in screen coordinates.
+	 * @return True if all of the characters were drawn, false if any of their glyphs are still
+	 * being rasterized. In the latter case, the caller should draw again on a subsequent frame.
+	 * @remarks Glyphs are rasterized and packed into the atlas the first time they are drawn.
+	 * Subsequent draws cost only vertexes.
+	 * @memberof Font
+	 */
+	_Bool (*drawCharacters)(Font *self, const char *chars, Renderer *renderer, const SDL_Point *origin);
+
+	/**
+	 * @fn const FontGlyph *Font::glyphForCharacter(Font *self, Uint16 character)
+	 * @brief Resolves the glyph for the given character, rasterizing it into the atlas if necessary.
+	 * @param self The Font.
+	 * @param character The UCS-2 character.
+	 * @return The glyph, or `NULL` if this Font does not provide it.
+	 * @remarks The glyph's metrics are resolved immediately. Its pixels are rasterized on a pool
+	 * of `DEFAULT_FONT_RASTERIZER_THREADS` worker threads, and the glyph remains `isPending`
+	 * until Font::uploadGlyphs packs them into the atlas.
+	 * @memberof Font
+	 */
+	const FontGlyph *(*glyphForCharacter)(Font *self, Uint16 character);
+
 	/**
 	 * @fn Font *Font::initWithAttributes(Font *self, const char *family, int size, int style)
 	 * @brief Initializes this Font with the given attributes.
@@ -141,6 +355,10 @@ struct FontInterface {
 	 * @param self The Font.
 	 * @param name The Fontconfig pattern.
 	 * @return The initialized Font, or `NULL` on error.
+	 * @remarks Resolved font files are recorded in `DEFAULT_FONT_RESOLUTION_CACHE`, within the
+	 * SDL preferences directory, so that subsequent runs may open them without initializing
+	 * Fontconfig. The file is written once, when the Font class is destroyed at exit. The cache is discarded when Fontconfig's configuration or font directories are
+	 * modified.
 	 * @memberof Font
 	 * @private
 	 */
@@ -161,10 +379,23 @@ struct FontInterface {
 	 * @fn void Font::renderDeviceDidReset(Font *self)
 	 * @brief This method should be invoked when the render context is invalidated.
 	 * @param self The Font.
+	 * @remarks The atlas textures are recreated on demand. If the window scale has changed, the
+	 * face is reopened at the new size, and its glyphs and measurements are discarded.
 	 * @memberof Font
 	 */
 	void (*renderDeviceDidReset)(Font *self);
 
+	/**
+	 * @static
+	 * @fn void Font::renderDeviceDidResetFonts(void)
+	 * @brief Resets every Font shared through the Font cache, once per render context reset.
+	 * @remarks The Renderer calls this from Renderer::renderDeviceDidReset. Fonts which are not
+	 * cached must be reset by their owners.
+	 * @see Font::renderDeviceDidReset(Font *)
+	 * @memberof Font
+	 */
+	void (*renderDeviceDidResetFonts)(void);
+
 	/**
 	 * @fn void Font::sizeCharacters(const Font *self, const char *chars, int *w, int *h)
 	 * @param self The Font.
@@ -172,9 +403,34 @@ struct FontInterface {
 	 * @param w The width to return.
 	 * @param h The height to return.
 	 * @return The size of the rendered characters in pixels.
+	 * @remarks Measurements are cached, so repeatedly sizing the same characters is cheap.
 	 * @memberof Font
 	 */
 	void (*sizeCharacters)(const Font *self, const char *chars, int *w, int *h);
+
+	/**
+	 * @static
+	 * @fn void Font::uploadGlyphs(void)
+	 * @brief Packs glyphs rasterized by the worker threads into their Fonts' atlases, and uploads
+	 * the affected atlas pages.
+	 * @remarks This method must be called on the thread which owns the OpenGL context. The
+	 * Renderer calls it from Renderer::beginFrame.
+	 * @memberof Font
+	 */
+	void (*uploadGlyphs)(void);
+
+	/**
+	 * @fn int Font::widthOfPrefix(Font *self, const char *chars, size_t length)
+	 * @brief Measures the width of a prefix of the given characters, as they are drawn.
+	 * @param self The Font.
+	 * @param chars The null-terminated UTF-8 encoded C string.
+	 * @param length The length of the prefix, in bytes.
+	 * @return The width of the prefix, in points.
+	 * @remarks This method sums the advances of the prefix's glyphs, and neither copies nor
+	 * remeasures the characters. It is suitable for positioning a caret.
+	 * @memberof Font
+	 */
+	int (*widthOfPrefix)(Font *self, const char *chars, size_t length);
 };
 
 /**
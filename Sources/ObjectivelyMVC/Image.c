@@ -32,6 +32,117 @@
  #define PKGDATADIR "."
 #endif
 
+/**
+ * @brief The shared Image cache, which does not retain its Images.
+ */
+static struct {
+
+	/**
+	 * @brief The cached Images, each of which has a name.
+	 */
+	Image **images;
+
+	/**
+	 * @brief The count and capacity of images.
+	 */
+	size_t count, capacity;
+} _cache;
+
+static ImageCacheStatistics _cacheStatistics;
+
+/**
+ * @brief An Image to be decoded on a worker thread.
+ */
+typedef struct ImageJob {
+
+	/**
+	 * @brief The Image, retained until its surface is delivered.
+	 */
+	Image *image;
+
+	/**
+	 * @brief The decoded surface, or `NULL` on error.
+	 */
+	SDL_Surface *surface;
+
+	/**
+	 * @brief The next job in the queue.
+	 */
+	struct ImageJob *next;
+} ImageJob;
+
+/**
+ * @brief A completion callback awaiting a pending Image.
+ */
+typedef struct {
+	Image *image;
+	ImageCompletion completion;
+	ident data;
+} ImageCallback;
+
+/**
+ * @brief The image decoder worker pool.
+ */
+static struct {
+
+	/**
+	 * @brief The worker threads.
+	 */
+	SDL_Thread *threads[DEFAULT_IMAGE_DECODER_THREADS];
+
+	/**
+	 * @brief The count of worker threads.
+	 */
+	int numThreads;
+
+	/**
+	 * @brief The lock, which guards the queues.
+	 */
+	SDL_mutex *lock;
+
+	/**
+	 * @brief Signaled when jobs are queued, or on shutdown.
+	 */
+	SDL_cond *cond;
+
+	/**
+	 * @brief Signaled when jobs are finished.
+	 */
+	SDL_cond *done;
+
+	/**
+	 * @brief The queued jobs, in first in, first out order.
+	 */
+	ImageJob *jobs, *lastJob;
+
+	/**
+	 * @brief The finished jobs, awaiting Image::dispatchCompletions.
+	 */
+	ImageJob *results;
+
+	/**
+	 * @brief The completion callbacks, which are accessed only on the main thread.
+	 */
+	ImageCallback *callbacks;
+
+	/**
+	 * @brief The count and capacity of callbacks.
+	 */
+	size_t numCallbacks, capacity;
+
+	/**
+	 * @brief True if the pool has been started, or failed to start.
+	 */
+	_Bool isStarted;
+
+	/**
+	 * @brief True if the workers should exit.
+	 */
+	_Bool isShutdown;
+} _decoder;
+
+static void uncacheImage(Image *image);
+
 #define _Class _Image
 
 #pragma mark - Object
@@ -43,13 +154,498 @@ static void dealloc(Object *self) {
 
 	Image *this = (Image *) self;
 
+	if (this->name) {
+		uncacheImage(this);
+	}
+
 	SDL_FreeSurface(this->surface);
 
 	super(Object, self, dealloc);
 }
 
+#pragma mark - Decoding
+
+/**
+ * @brief Loads and decodes the Resource by the given name.
+ * @return The decoded surface, or `NULL` on error.
+ */
+static SDL_Surface *decodeImage(const char *name) {
+
+	SDL_Surface *surface = NULL;
+
+	Resource *resource = $$(Resource, resourceWithName, name);
+	if (resource) {
+
+		SDL_RWops *ops = SDL_RWFromConstMem(resource->data->bytes, (int) resource->data->length);
+		if (ops) {
+			surface = IMG_Load_RW(ops, 1);
+		}
+
+		release(resource);
+	}
+
+	return surface;
+}
+
+/**
+ * @brief Frees the given list of jobs, releasing their Images.
+ */
+static void freeJobs(ImageJob *job) {
+
+	while (job) {
+		ImageJob *next = job->next;
+
+		release(job->image);
+		SDL_FreeSurface(job->surface);
+		free(job);
+
+		job = next;
+	}
+}
+
+/**
+ * @brief The worker thread entry point.
+ */
+static int decodeImages(void *data) {
+
+	SDL_LockMutex(_decoder.lock);
+
+	while (true) {
+
+		while (_decoder.jobs == NULL && _decoder.isShutdown == false) {
+			SDL_CondWait(_decoder.cond, _decoder.lock);
+		}
+
+		if (_decoder.isShutdown) {
+			break;
+		}
+
+		ImageJob *job = _decoder.jobs;
+
+		_decoder.jobs = job->next;
+		if (_decoder.jobs == NULL) {
+			_decoder.lastJob = NULL;
+		}
+
+		SDL_UnlockMutex(_decoder.lock);
+
+		job->surface = decodeImage(job->image->name);
+
+		SDL_LockMutex(_decoder.lock);
+
+		job->next = _decoder.results;
+		_decoder.results = job;
+
+		SDL_CondBroadcast(_decoder.done);
+	}
+
+	SDL_UnlockMutex(_decoder.lock);
+	return 0;
+}
+
+/**
+ * @brief Starts the worker pool, if it has not yet been started.
+ * @return True if Images may be decoded on worker threads.
+ */
+static _Bool startDecoder(void) {
+
+	if (_decoder.isStarted == false) {
+		_decoder.isStarted = true;
+
+		IMG_Init(IMG_INIT_JPG | IMG_INIT_PNG);
+
+		const int numThreads = min(DEFAULT_IMAGE_DECODER_THREADS, max(1, SDL_GetCPUCount() - 1));
+		if (numThreads > 0) {
+
+			_decoder.lock = SDL_CreateMutex();
+			_decoder.cond = SDL_CreateCond();
+			_decoder.done = SDL_CreateCond();
+
+			if (_decoder.lock && _decoder.cond && _decoder.done) {
+				for (int i = 0; i < numThreads; i++) {
+
+					SDL_Thread *thread = SDL_CreateThread(decodeImages, "Image", NULL);
+					if (thread == NULL) {
+						MVC_LogWarn("Failed to create image decoder: %s\n", SDL_GetError());
+						break;
+					}
+
+					_decoder.threads[_decoder.numThreads++] = thread;
+				}
+			}
+		}
+	}
+
+	return _decoder.numThreads > 0;
+}
+
+/**
+ * @brief Stops the worker pool, discarding any queued or finished jobs.
+ */
+static void stopDecoder(void) {
+
+	if (_decoder.numThreads) {
+
+		SDL_LockMutex(_decoder.lock);
+
+		_decoder.isShutdown = true;
+		SDL_CondBroadcast(_decoder.cond);
+
+		SDL_UnlockMutex(_decoder.lock);
+
+		for (int i = 0; i < _decoder.numThreads; i++) {
+			SDL_WaitThread(_decoder.threads[i], NULL);
+		}
+	}
+
+	ImageJob *jobs = _decoder.jobs, *results = _decoder.results;
+
+	if (_decoder.cond) {
+		SDL_DestroyCond(_decoder.cond);
+	}
+
+	if (_decoder.done) {
+		SDL_DestroyCond(_decoder.done);
+	}
+
+	if (_decoder.lock) {
+		SDL_DestroyMutex(_decoder.lock);
+	}
+
+	free(_decoder.callbacks);
+
+	memset(&_decoder, 0, sizeof(_decoder));
+
+	freeJobs(jobs);
+	freeJobs(results);
+}
+
+/**
+ * @brief Queues the given Image for decoding on a worker thread, or decodes it immediately if
+ * the pool is unavailable. In either case, its surface is delivered by Image::dispatchCompletions.
+ */
+static void queueImage(Image *image) {
+
+	ImageJob *job = calloc(1, sizeof(ImageJob));
+	assert(job);
+
+	job->image = retain(image);
+
+	if (startDecoder()) {
+		SDL_LockMutex(_decoder.lock);
+
+		if (_decoder.lastJob) {
+			_decoder.lastJob->next = job;
+		} else {
+			_decoder.jobs = job;
+		}
+
+		_decoder.lastJob = job;
+
+		SDL_CondSignal(_decoder.cond);
+		SDL_UnlockMutex(_decoder.lock);
+	} else {
+		job->surface = decodeImage(image->name);
+
+		job->next = _decoder.results;
+		_decoder.results = job;
+	}
+}
+
+/**
+ * @brief Takes the surface of the given pending Image from the worker pool, waiting for it if it
+ * is being decoded, or decoding it on the calling thread if it is still queued.
+ * @return The decoded surface, or `NULL` on error.
+ */
+static SDL_Surface *awaitImage(Image *image) {
+
+	ImageJob *job = NULL;
+	_Bool isQueued = false;
+
+	if (_decoder.lock) {
+		SDL_LockMutex(_decoder.lock);
+	}
+
+	while (job == NULL) {
+
+		ImageJob *prev = NULL;
+		for (ImageJob *j = _decoder.jobs; j; prev = j, j = j->next) {
+			if (j->image == image) {
+				if (prev) {
+					prev->next = j->next;
+				} else {
+					_decoder.jobs = j->next;
+				}
+				if (_decoder.lastJob == j) {
+					_decoder.lastJob = prev;
+				}
+				job = j;
+				isQueued = true;
+				break;
+			}
+		}
+
+		if (job) {
+			break;
+		}
+
+		for (ImageJob **j = &_decoder.results; *j; j = &(*j)->next) {
+			if ((*j)->image == image) {
+				job = *j;
+				*j = job->next;
+				break;
+			}
+		}
+
+		if (job == NULL) {
+			if (_decoder.numThreads == 0) {
+				break;
+			}
+			SDL_CondWait(_decoder.done, _decoder.lock);
+		}
+	}
+
+	if (_decoder.lock) {
+		SDL_UnlockMutex(_decoder.lock);
+	}
+
+	SDL_Surface *surface = NULL;
+
+	if (job) {
+		job->next = NULL;
+
+		if (isQueued) {
+			surface = decodeImage(image->name);
+		} else {
+			surface = job->surface;
+			job->surface = NULL;
+		}
+
+		freeJobs(job);
+	}
+
+	return surface;
+}
+
+/**
+ * @brief Delivers the given surface to the given pending Image, and invokes its completion
+ * callbacks.
+ */
+static void completeImage(Image *image, SDL_Surface *surface) {
+
+	image->surface = surface;
+	image->isPending = false;
+
+	if (image->surface) {
+		_cacheStatistics.bytes += image->surface->pitch * image->surface->h;
+	} else {
+		MVC_LogWarn("Failed to decode image %s\n", image->name);
+		uncacheImage(image);
+	}
+
+	for (size_t i = 0; i < _decoder.numCallbacks;) {
+
+		const ImageCallback callback = _decoder.callbacks[i];
+		if (callback.image != image) {
+			i++;
+			continue;
+		}
+
+		_decoder.callbacks[i] = _decoder.callbacks[--_decoder.numCallbacks];
+
+		callback.completion(image, callback.data);
+	}
+}
+
+/**
+ * @brief Adds the given completion callback for the given pending Image.
+ */
+static void addCallback(Image *image, ImageCompletion completion, ident data) {
+
+	if (_decoder.numCallbacks == _decoder.capacity) {
+		_decoder.capacity = _decoder.capacity ? _decoder.capacity * 2 : 16;
+		_decoder.callbacks = realloc(_decoder.callbacks, _decoder.capacity * sizeof(ImageCallback));
+		assert(_decoder.callbacks);
+	}
+
+	_decoder.callbacks[_decoder.numCallbacks++] = (ImageCallback) {
+		.image = image,
+		.completion = completion,
+		.data = data
+	};
+}
+
+/**
+ * @brief Adds the given Image to the shared Image cache.
+ */
+static void cacheImage(Image *image, const char *name) {
+
+	if (_cache.count == _cache.capacity) {
+		_cache.capacity = _cache.capacity ? _cache.capacity * 2 : 64;
+		_cache.images = realloc(_cache.images, _cache.capacity * sizeof(Image *));
+		assert(_cache.images);
+	}
+
+	image->name = strdup(name);
+	assert(image->name);
+
+	_cache.images[_cache.count++] = image;
+
+	_cacheStatistics.count++;
+	if (image->surface) {
+		_cacheStatistics.bytes += image->surface->pitch * image->surface->h;
+	}
+}
+
+/**
+ * @brief Removes the given Image from the shared Image cache.
+ */
+static void uncacheImage(Image *image) {
+
+	for (size_t i = 0; i < _cache.count; i++) {
+		if (_cache.images[i] == image) {
+			_cache.images[i] = _cache.images[--_cache.count];
+
+			_cacheStatistics.count--;
+			if (image->surface) {
+				_cacheStatistics.bytes -= image->surface->pitch * image->surface->h;
+			}
+			break;
+		}
+	}
+
+	free(image->name);
+	image->name = NULL;
+}
+
 #pragma mark - Image
 
+/**
+ * @fn void Image::addCompletion(Image *self, ImageCompletion completion, ident data)
+ * @memberof Image
+ */
+static void addCompletion(Image *self, ImageCompletion completion, ident data) {
+
+	assert(completion);
+
+	if (self->isPending) {
+		addCallback(self, completion, data);
+	} else {
+		completion(self, data);
+	}
+}
+
+/**
+ * @fn ImageCacheStatistics Image::cacheStatistics(void)
+ * @memberof Image
+ */
+static ImageCacheStatistics cacheStatistics(void) {
+	return _cacheStatistics;
+}
+
+/**
+ * @fn Image *Image::cachedImageWithName(const char *name)
+ * @memberof Image
+ */
+static Image *cachedImageWithName(const char *name) {
+
+	assert(name);
+
+	for (size_t i = 0; i < _cache.count; i++) {
+		Image *image = _cache.images[i];
+		if (strcmp(image->name, name) == 0) {
+			_cacheStatistics.hits++;
+
+			if (image->isPending) {
+				completeImage(image, awaitImage(image));
+			}
+
+			return image->surface ? retain(image) : NULL;
+		}
+	}
+
+	_cacheStatistics.misses++;
+
+	Image *image = $(alloc(Image), initWithName, name);
+	if (image) {
+		cacheImage(image, name);
+	}
+
+	return image;
+}
+
+/**
+ * @fn void Image::dispatchCompletions(void)
+ * @memberof Image
+ */
+static void dispatchCompletions(void) {
+
+	if (_decoder.lock) {
+		SDL_LockMutex(_decoder.lock);
+	}
+
+	ImageJob *results = _decoder.results;
+	_decoder.results = NULL;
+
+	if (_decoder.lock) {
+		SDL_UnlockMutex(_decoder.lock);
+	}
+
+	for (ImageJob *job = results; job; job = job->next) {
+
+		SDL_Surface *surface = job->surface;
+		job->surface = NULL;
+
+		completeImage(job->image, surface);
+	}
+
+	freeJobs(results);
+}
+
+/**
+ * @fn Image *Image::imageWithNameAsync(const char *name, ImageCompletion completion, ident data)
+ * @memberof Image
+ */
+static Image *imageWithNameAsync(const char *name, ImageCompletion completion, ident data) {
+
+	assert(name);
+
+	for (size_t i = 0; i < _cache.count; i++) {
+
+		Image *image = _cache.images[i];
+		if (strcmp(image->name, name) == 0) {
+			_cacheStatistics.hits++;
+
+			if (image->isPending) {
+				if (completion) {
+					addCallback(image, completion, data);
+				}
+			} else if (completion) {
+				completion(image, data);
+			}
+
+			return retain(image);
+		}
+	}
+
+	_cacheStatistics.misses++;
+
+	Image *image = (Image *) $((Object *) alloc(Image), init);
+	assert(image);
+
+	image->isPending = true;
+
+	cacheImage(image, name);
+
+	if (completion) {
+		addCallback(image, completion, data);
+	}
+
+	queueImage(image);
+
+	return image;
+}
+
 /**
  * @fn Image *Image::initWithBytes(Image *self, const uint8_t *bytes, size_t length)
  * @memberof Image
@@ -118,6 +714,22 @@ Image *initWithSurface(Image *self, SDL_Surface *surface) {
 	return self;
 }
 
+/**
+ * @fn void Image::removeCompletion(Image *self, ImageCompletion completion, ident data)
+ * @memberof Image
+ */
+static void removeCompletion(Image *self, ImageCompletion completion, ident data) {
+
+	for (size_t i = 0; i < _decoder.numCallbacks; i++) {
+
+		const ImageCallback *callback = &_decoder.callbacks[i];
+		if (callback->image == self && callback->completion == completion && callback->data == data) {
+			_decoder.callbacks[i] = _decoder.callbacks[--_decoder.numCallbacks];
+			break;
+		}
+	}
+}
+
 #pragma mark - Class lifecycle
 
 /**
@@ -127,11 +739,17 @@ static void initialize(Class *clazz) {
 
 	((ObjectInterface *) clazz->def->interface)->dealloc = dealloc;
 
+	((ImageInterface *) clazz->def->interface)->addCompletion = addCompletion;
+	((ImageInterface *) clazz->def->interface)->cacheStatistics = cacheStatistics;
+	((ImageInterface *) clazz->def->interface)->cachedImageWithName = cachedImageWithName;
+	((ImageInterface *) clazz->def->interface)->dispatchCompletions = dispatchCompletions;
+	((ImageInterface *) clazz->def->interface)->imageWithNameAsync = imageWithNameAsync;
 	((ImageInterface *) clazz->def->interface)->initWithBytes = initWithBytes;
 	((ImageInterface *) clazz->def->interface)->initWithData = initWithData;
 	((ImageInterface *) clazz->def->interface)->initWithName = initWithName;
 	((ImageInterface *) clazz->def->interface)->initWithResource = initWithResource;
 	((ImageInterface *) clazz->def->interface)->initWithSurface = initWithSurface;
+	((ImageInterface *) clazz->def->interface)->removeCompletion = removeCompletion;
 
 	$$(Resource, addResourcePath, PKGDATADIR);
 
@@ -141,6 +759,18 @@ static void initialize(Class *clazz) {
 	}
 }
 
+/**
+ * @see Class::destroy(Class *)
+ */
+static void destroy(Class *clazz) {
+
+	stopDecoder();
+
+	free(_cache.images);
+
+	memset(&_cache, 0, sizeof(_cache));
+}
+
 /**
  * @fn Class *Image::_Image(void)
  * @memberof Image
@@ -156,6 +786,7 @@ Class *_Image(void) {
 		clazz.interfaceOffset = offsetof(Image, interface);
 		clazz.interfaceSize = sizeof(ImageInterface);
 		clazz.initialize = initialize;
+		clazz.destroy = destroy;
 	});
 
 	return &clazz;
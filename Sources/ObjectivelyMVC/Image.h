@@ -28,9 +28,44 @@
  * @brief Image loading.
  */
 
+#define DEFAULT_IMAGE_DECODER_THREADS 2
+
+/**
+ * @brief Statistics of the shared Image cache.
+ */
+typedef struct {
+
+	/**
+	 * @brief The count of lookups satisfied by the cache.
+	 */
+	size_t hits;
+
+	/**
+	 * @brief The count of lookups which decoded an Image.
+	 */
+	size_t misses;
+
+	/**
+	 * @brief The count of cached Images.
+	 */
+	size_t count;
+
+	/**
+	 * @brief The size of the cached Images' surfaces, in bytes.
+	 */
+	size_t bytes;
+} ImageCacheStatistics;
+
 typedef struct Image Image;
 typedef struct ImageInterface ImageInterface;
 
+/**
+ * @brief The completion callback of Image::imageWithNameAsync.
+ * @param image The Image, whose surface is `NULL` if it could not be decoded.
+ * @param data User data.
+ */
+typedef void (*ImageCompletion)(Image *image, ident data);
+
 /**
  * @brief Image loading.
  * @extends Object
@@ -49,7 +84,18 @@ struct Image {
 	ImageInterface *interface;
 
 	/**
-	 * @brief The backing surface.
+	 * @brief True if this Image is being decoded on a worker thread.
+	 */
+	_Bool isPending;
+
+	/**
+	 * @brief The name by which this Image is cached, or `NULL`.
+	 * @private
+	 */
+	char *name;
+
+	/**
+	 * @brief The backing surface, or `NULL` if this Image is pending or could not be decoded.
 	 */
 	SDL_Surface *surface;
 };
@@ -64,6 +110,70 @@ struct ImageInterface {
 	 */
 	ObjectInterface objectInterface;
 
+	/**
+	 * @fn void Image::addCompletion(Image *self, ImageCompletion completion, ident data)
+	 * @brief Adds a completion callback, invoked when this Image is decoded.
+	 * @param self The Image.
+	 * @param completion The completion callback.
+	 * @param data User data.
+	 * @remarks If this Image is not pending, the callback is invoked immediately. Otherwise, it is
+	 * invoked by Image::dispatchCompletions, unless it is first removed.
+	 * @see Image::removeCompletion(Image *, ImageCompletion, ident)
+	 * @memberof Image
+	 */
+	void (*addCompletion)(Image *self, ImageCompletion completion, ident data);
+
+	/**
+	 * @static
+	 * @fn ImageCacheStatistics Image::cacheStatistics(void)
+	 * @return The statistics of the shared Image cache.
+	 * @memberof Image
+	 */
+	ImageCacheStatistics (*cacheStatistics)(void);
+
+	/**
+	 * @static
+	 * @fn Image *Image::cachedImageWithName(const char *name)
+	 * @param name The image name.
+	 * @return A retained, shared Image with the given name, or `NULL` on error.
+	 * @remarks The cache does not retain its Images. Images are shared while any references to
+	 * them remain, and are removed from the cache when they are deallocated. Views which reference
+	 * the same image therefore share a single decoded surface, and so a single atlas region.
+	 * @remarks If the Image is pending, it is decoded (or its decoding awaited) before returning,
+	 * so that each name is decoded only once.
+	 * @memberof Image
+	 */
+	Image *(*cachedImageWithName)(const char *name);
+
+	/**
+	 * @static
+	 * @fn void Image::dispatchCompletions(void)
+	 * @brief Delivers the surfaces of Images decoded since the previous call, and invokes their
+	 * completion callbacks.
+	 * @remarks This method must be called on the main thread. The Renderer calls it from
+	 * Renderer::beginFrame.
+	 * @memberof Image
+	 */
+	void (*dispatchCompletions)(void);
+
+	/**
+	 * @static
+	 * @fn Image *Image::imageWithNameAsync(const char *name, ImageCompletion completion, ident data)
+	 * @brief Loads the Resource by the given name, and decodes it on a pool of
+	 * `DEFAULT_IMAGE_DECODER_THREADS` worker threads.
+	 * @param name The image name.
+	 * @param completion The completion callback, or `NULL`.
+	 * @param data User data for the completion callback.
+	 * @return A retained, shared Image with the given name, which is `isPending` until it is
+	 * decoded.
+	 * @remarks The surface is delivered, and the completion callback invoked, on the main thread
+	 * by Image::dispatchCompletions. If the Image is already cached and decoded, the completion
+	 * callback is invoked immediately.
+	 * @see Image::cachedImageWithName(const char *)
+	 * @memberof Image
+	 */
+	Image *(*imageWithNameAsync)(const char *name, ImageCompletion completion, ident data);
+
 	/**
 	 * @fn Image *Image::initWithBytes(Image *self, const uint8_t *bytes, size_t length)
 	 * @brief Initializes this Image with the specified bytes.
@@ -118,6 +228,16 @@ struct ImageInterface {
 	 * @memberof Image
 	 */
 	Image *(*initWithSurface)(Image *self, SDL_Surface *surface);
+
+	/**
+	 * @fn void Image::removeCompletion(Image *self, ImageCompletion completion, ident data)
+	 * @brief Removes a completion callback which has not yet been invoked.
+	 * @param self The Image.
+	 * @param completion The completion callback.
+	 * @param data The user data with which the callback was added.
+	 * @memberof Image
+	 */
+	void (*removeCompletion)(Image *self, ImageCompletion completion, ident data);
 };
 
 /**
@@ -42,6 +42,17 @@ const EnumName GLBlendNames[] = MakeEnumNames(
 
 #define _Class _ImageView
 
+/**
+ * @brief ImageCompletion which displays the decoded Image.
+ */
+static void imageDidDecode(Image *image, ident data) {
+
+	ImageView *this = (ImageView *) data;
+	if (this->image == image) {
+		$((View *) this, setNeedsDisplay);
+	}
+}
+
 #pragma mark - Object
 
 /**
@@ -52,8 +63,11 @@ static void dealloc(Object *self) {
 	ImageView *this = (ImageView *) self;
 
 	if (this->image) {
+		$(this->image, removeCompletion, imageDidDecode, this);
 		release(this->image);
-		glDeleteTextures(1, &this->texture);
+		if (this->texture.texture && this->texture.isShared == false) {
+			glDeleteTextures(1, &this->texture.texture);
+		}
 	}
 
 	super(Object, self, dealloc);
@@ -96,20 +110,29 @@ static void render(View *self, Renderer *renderer) {
 
 	ImageView *this = (ImageView *) self;
 
-	if (this->texture == 0) {
-		if (this->image) {
-			this->texture = $(renderer, createTexture, this->image->surface);
-			assert(this->texture);
+	if (this->texture.texture == 0) {
+		if (this->image && this->image->surface) {
+			$(renderer, requestTextureRegion, self, this->image->surface, &this->texture);
 		}
 	}
 
-	if (this->texture) {
+	if (this->texture.texture) {
 
 		// TODO: Actually use self->blend
 
 		$(renderer, setDrawColor, &this->color);
 		const SDL_Rect frame = $(self, renderFrame);
-		$(renderer, drawTexture, this->texture, &frame);
+		$(renderer, drawTextureRegion, this->texture.texture, this->texture.texcoords, &frame);
+		$(renderer, setDrawColor, &Colors.White);
+
+	} else if (this->image) {
+
+		SDL_Color placeholder = this->color;
+		placeholder.a /= 8;
+
+		$(renderer, setDrawColor, &placeholder);
+		const SDL_Rect frame = $(self, renderFrame);
+		$(renderer, drawRectFilled, &frame);
 		$(renderer, setDrawColor, &Colors.White);
 	}
 }
@@ -123,7 +146,7 @@ static void renderDeviceDidReset(View *self) {
 
 	ImageView *this = (ImageView *) self;
 
-	this->texture = 0;
+	this->texture.texture = 0;
 }
 
 #pragma mark - ImageView
@@ -156,7 +179,7 @@ static ImageView *initWithImage(ImageView *self, Image *image) {
 
 		$(self, setImage, image);
 
-		if (self->image) {
+		if (self->image && self->image->surface) {
 			self->view.frame.w = image->surface->w;
 			self->view.frame.h = image->surface->h;
 		}
@@ -171,6 +194,10 @@ static ImageView *initWithImage(ImageView *self, Image *image) {
  */
 static void setImage(ImageView *self, Image *image) {
 
+	if (self->image) {
+		$(self->image, removeCompletion, imageDidDecode, self);
+	}
+
 	release(self->image);
 
 	if (image) {
@@ -179,7 +206,17 @@ static void setImage(ImageView *self, Image *image) {
 		self->image = NULL;
 	}
 
-	self->texture = 0;
+	if (self->image && self->image->isPending) {
+		$(self->image, addCompletion, imageDidDecode, self);
+	}
+
+	if (self->texture.texture && self->texture.isShared == false) {
+		glDeleteTextures(1, &self->texture.texture);
+	}
+
+	self->texture.texture = 0;
+
+	$((View *) self, setNeedsDisplay);
 }
 
 /**
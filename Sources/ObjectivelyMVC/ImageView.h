@@ -67,13 +67,17 @@ struct ImageView {
 
 	/**
 	 * @brief The image.
+	 * @remarks The image may be pending (see Image::imageWithNameAsync), in which case a
+	 * placeholder is drawn until it is decoded, and the ImageView is then displayed again.
 	 */
 	Image *image;
 
 	/**
-	 * @brief The texture.
+	 * @brief The texture, which may be a region of the Renderer's shared atlas.
+	 * @remarks Textures are requested through Renderer::requestTextureRegion. Until the texture is
+	 * resident, a translucent placeholder is drawn in the drawing color.
 	 */
-	GLuint texture;
+	RendererTexture texture;
 };
 
 /**
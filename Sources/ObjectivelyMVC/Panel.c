@@ -197,6 +197,10 @@ static void respondToEvent(View *self, const SDL_Event *event) {
 		} else if (this->isDragging) {
 			self->frame.x += event->motion.xrel;
 			self->frame.y += event->motion.yrel;
+
+			$(self, setNeedsDisplay);
+
+			$(self, invalidateFrames);
 		}
 	}
 }
@@ -240,6 +244,10 @@ static Panel *initWithFrame(Panel *self, const SDL_Rect *frame) {
 
 		self->stackView.spacing = DEFAULT_PANEL_SPACING;
 
+		if (this->interface->respondToEvent == respondToEvent) {
+			this->eventMask = ViewEventMaskMouse;
+		}
+
 		self->contentView = $(alloc(StackView), initWithFrame, NULL);
 		assert(self->contentView);
 
@@ -22,35 +22,1317 @@
  */
 
 #include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
 
+#include <ObjectivelyMVC/Font.h>
+#include <ObjectivelyMVC/Image.h>
 #include <ObjectivelyMVC/Log.h>
 #include <ObjectivelyMVC/Renderer.h>
 #include <ObjectivelyMVC/View.h>
 
+#define RENDERER_REGIONS_PER_DRAW 64
+
+/**
+ * @brief A batched vertex: position, texture coordinate and color.
+ */
+typedef struct {
+	GLfloat x, y;
+	GLfloat s, t;
+	SDL_Color color;
+} RendererVertex;
+
+/**
+ * @brief The vertex batch, accumulated while Renderer::batchesDrawCalls is `true`.
+ */
+struct RendererBatch {
+
+	/**
+	 * @brief The vertexes.
+	 */
+	RendererVertex vertexes[DEFAULT_RENDERER_BATCH_SIZE];
+
+	/**
+	 * @brief The count of pending vertexes.
+	 */
+	size_t count;
+
+	/**
+	 * @brief The primitive type of the pending vertexes.
+	 */
+	GLenum mode;
+
+	/**
+	 * @brief The texture of the pending vertexes, or `0`.
+	 */
+	GLuint texture;
+
+	/**
+	 * @brief The current draw color.
+	 */
+	SDL_Color color;
+
+	/**
+	 * @brief True if primitives should be clipped to `clip`.
+	 */
+	_Bool clips;
+
+	/**
+	 * @brief The current clipping frame.
+	 */
+	SDL_Rect clip;
+};
+
+/**
+ * @brief A View added to the Renderer for the current frame, with its depth.
+ */
+typedef struct {
+	View *view;
+	int depth;
+	size_t index;
+	SDL_Rect frame;
+	_Bool needsDisplay;
+} RendererDrawItem;
+
+/**
+ * @brief The Views added for the current and previous frames, used to detect changes to the
+ * View hierarchy so that the sorted draw list is only rebuilt when necessary.
+ */
+struct RendererDrawList {
+
+	/**
+	 * @brief The items added for the current frame, in hierarchy order.
+	 */
+	RendererDrawItem *items;
+
+	/**
+	 * @brief The items added for the previous frame, in hierarchy order.
+	 */
+	RendererDrawItem *previousItems;
+
+	/**
+	 * @brief The counts of items and previousItems.
+	 */
+	size_t count, previousCount;
+
+	/**
+	 * @brief The capacity of items and previousItems.
+	 */
+	size_t capacity;
+};
+
+/**
+ * @brief The offscreen framebuffer into which Views are drawn while Renderer::compositesViews is
+ * `true`, its damaged regions, and the framebuffer with which Views are rasterized.
+ */
+struct RendererComposite {
+
+	/**
+	 * @brief The framebuffer object and its color texture.
+	 */
+	GLuint framebuffer, texture;
+
+	/**
+	 * @brief The size of the framebuffer, in pixels.
+	 */
+	int w, h;
+
+	/**
+	 * @brief True if the framebuffer holds a complete rendering of the View hierarchy.
+	 */
+	_Bool valid;
+
+	/**
+	 * @brief True if framebuffer objects are not supported by the current context.
+	 */
+	_Bool unsupported;
+
+	/**
+	 * @brief The damaged regions, in window coordinates.
+	 */
+	SDL_Rect damage[DEFAULT_RENDERER_DAMAGE_RECTS];
+
+	/**
+	 * @brief The count of damaged regions.
+	 */
+	size_t numDamage;
+
+	/**
+	 * @brief The damaged region being rendered, in drawable coordinates, or `NULL`.
+	 */
+	const SDL_Rect *scissor;
+
+	/**
+	 * @brief The framebuffer with which Views are rasterized, and the texture attached to it.
+	 */
+	GLuint rasterFramebuffer, rasterTexture;
+
+	/**
+	 * @brief The frame of the View being rasterized, in window coordinates, or `NULL`.
+	 */
+	const SDL_Rect *target;
+
+	/**
+	 * @brief The nesting depth of offscreen rendering, which blends premultiplied color.
+	 */
+	int offscreen;
+
+	/**
+	 * @brief The framebuffer object entry points, resolved from the current context.
+	 */
+	PFNGLGENFRAMEBUFFERSPROC GenFramebuffers;
+	PFNGLDELETEFRAMEBUFFERSPROC DeleteFramebuffers;
+	PFNGLBINDFRAMEBUFFERPROC BindFramebuffer;
+	PFNGLFRAMEBUFFERTEXTURE2DPROC FramebufferTexture2D;
+	PFNGLCHECKFRAMEBUFFERSTATUSPROC CheckFramebufferStatus;
+	PFNGLBLENDFUNCSEPARATEPROC BlendFuncSeparate;
+};
+
+/**
+ * @brief A texture requested through Renderer::requestTexture.
+ */
+typedef struct {
+
+	/**
+	 * @brief The requesting View, retained.
+	 */
+	View *view;
+
+	/**
+	 * @brief The surface, referenced.
+	 */
+	SDL_Surface *surface;
+
+	/**
+	 * @brief The texture, or `0` if it has not been uploaded.
+	 */
+	GLuint texture;
+
+	/**
+	 * @brief The size of the surface, in bytes.
+	 */
+	size_t bytes;
+
+	/**
+	 * @brief The visible area of the View, in pixels, by which uploads are prioritized.
+	 */
+	int area;
+
+	/**
+	 * @brief True if the texture was requested since the last Renderer::beginFrame.
+	 */
+	_Bool isRequested;
+} RendererUpload;
+
+/**
+ * @brief The textures awaiting upload or retrieval, and the statistics of the current frame.
+ */
+struct RendererUploadQueue {
+
+	/**
+	 * @brief The requested textures.
+	 */
+	RendererUpload *uploads;
+
+	/**
+	 * @brief The count and capacity of uploads.
+	 */
+	size_t count, capacity;
+
+	/**
+	 * @brief The statistics of the current frame.
+	 */
+	RendererUploadStatistics statistics;
+};
+
+/**
+ * @brief A page of the shared atlas, shelf-packed with small surfaces.
+ */
+typedef struct {
+
+	/**
+	 * @brief The texture.
+	 */
+	GLuint texture;
+
+	/**
+	 * @brief The packing position within the current shelf.
+	 */
+	int x, y;
+
+	/**
+	 * @brief The height of the current shelf.
+	 */
+	int shelfHeight;
+
+	/**
+	 * @brief The count of entries packed into this page.
+	 */
+	size_t count;
+} RendererAtlasPage;
+
+/**
+ * @brief A surface packed into the shared atlas.
+ */
+typedef struct {
+
+	/**
+	 * @brief The surface, referenced so that its release may be detected.
+	 */
+	SDL_Surface *surface;
+
+	/**
+	 * @brief The page.
+	 */
+	RendererAtlasPage *page;
+
+	/**
+	 * @brief The region of the page occupied by the surface, in pixels.
+	 */
+	SDL_Rect rect;
+
+	/**
+	 * @brief The index of the next entry in this entry's hash bucket, or `-1`.
+	 */
+	int bucketNext;
+} RendererAtlasEntry;
+
+/**
+ * @brief The shared atlas of small surfaces.
+ */
+struct RendererAtlas {
+
+	/**
+	 * @brief The pages.
+	 */
+	RendererAtlasPage **pages;
+
+	/**
+	 * @brief The count of pages.
+	 */
+	size_t numPages;
+
+	/**
+	 * @brief The entries.
+	 */
+	RendererAtlasEntry *entries;
+
+	/**
+	 * @brief The count and capacity of entries.
+	 */
+	size_t count, capacity;
+
+	/**
+	 * @brief The index of the first entry in each hash bucket, keyed by surface, or `-1`.
+	 */
+	int buckets[DEFAULT_RENDERER_ATLAS_BUCKETS];
+};
+
 #define _Class _Renderer
 
-#pragma mark - Object
+#pragma mark - Object
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	Renderer *this = (Renderer *) self;
+
+	if (this->composite->framebuffer) {
+		this->composite->DeleteFramebuffers(1, &this->composite->framebuffer);
+		glDeleteTextures(1, &this->composite->texture);
+	}
+
+	if (this->composite->rasterFramebuffer) {
+		this->composite->DeleteFramebuffers(1, &this->composite->rasterFramebuffer);
+	}
+
+	free(this->composite);
+
+	free(this->batch);
+
+	free(this->drawList->items);
+	free(this->drawList->previousItems);
+	free(this->drawList);
+
+	release(this->views);
+
+	for (size_t i = 0; i < this->uploads->count; i++) {
+		RendererUpload *upload = &this->uploads->uploads[i];
+		if (upload->texture) {
+			glDeleteTextures(1, &upload->texture);
+		}
+		release(upload->view);
+		SDL_FreeSurface(upload->surface);
+	}
+
+	free(this->uploads->uploads);
+	free(this->uploads);
+
+	for (size_t i = 0; i < this->atlas->count; i++) {
+		SDL_FreeSurface(this->atlas->entries[i].surface);
+	}
+
+	for (size_t i = 0; i < this->atlas->numPages; i++) {
+		glDeleteTextures(1, &this->atlas->pages[i]->texture);
+		free(this->atlas->pages[i]);
+	}
+
+	free(this->atlas->entries);
+	free(this->atlas->pages);
+	free(this->atlas);
+
+	super(Object, self, dealloc);
+}
+
+#pragma mark - Batching
+
+/**
+ * @brief Reserves `count` vertexes of the given primitive type and texture in the batch,
+ * flushing the batch first if necessary.
+ * @return The first reserved vertex.
+ */
+static RendererVertex *reserveVertexes(const Renderer *self, GLenum mode, GLuint texture, size_t count) {
+
+	struct RendererBatch *batch = self->batch;
+
+	if (batch->mode != mode || batch->texture != texture || batch->count + count > lengthof(batch->vertexes)) {
+		$(self, flush);
+
+		batch->mode = mode;
+		batch->texture = texture;
+	}
+
+	RendererVertex *vertexes = batch->vertexes + batch->count;
+	batch->count += count;
+
+	return vertexes;
+}
+
+/**
+ * @brief Batches a line segment, clipped to the current clipping frame.
+ */
+static void batchLine(const Renderer *self, const SDL_Point *a, const SDL_Point *b) {
+
+	const struct RendererBatch *batch = self->batch;
+
+	const GLfloat dx = b->x - a->x, dy = b->y - a->y;
+	GLfloat t0 = 0.0, t1 = 1.0;
+
+	if (batch->clips) {
+		const SDL_Rect *clip = &batch->clip;
+
+		const GLfloat p[] = { -dx, dx, -dy, dy };
+		const GLfloat q[] = {
+			a->x - clip->x,
+			clip->x + clip->w - a->x,
+			a->y - clip->y,
+			clip->y + clip->h - a->y
+		};
+
+		for (size_t i = 0; i < lengthof(p); i++) {
+			if (p[i] == 0.0) {
+				if (q[i] < 0.0) {
+					return;
+				}
+			} else {
+				const GLfloat t = q[i] / p[i];
+				if (p[i] < 0.0) {
+					t0 = max(t0, t);
+				} else {
+					t1 = min(t1, t);
+				}
+				if (t0 > t1) {
+					return;
+				}
+			}
+		}
+	}
+
+	RendererVertex *v = reserveVertexes(self, GL_LINES, 0, 2);
+
+	v[0] = (RendererVertex) { .x = a->x + t0 * dx, .y = a->y + t0 * dy, .color = batch->color };
+	v[1] = (RendererVertex) { .x = a->x + t1 * dx, .y = a->y + t1 * dy, .color = batch->color };
+}
+
+/**
+ * @brief Batches a quad, clipped to the current clipping frame.
+ * @param texture The texture, or `0`.
+ * @param texcoords The texture coordinates `{ s0, t0, s1, t1 }` of the quad's extents.
+ * @param x0, y0, x1, y1 The extents of the quad.
+ */
+static void batchQuad(const Renderer *self, GLuint texture, const GLfloat *texcoords,
+					  GLfloat x0, GLfloat y0, GLfloat x1, GLfloat y1) {
+
+	const struct RendererBatch *batch = self->batch;
+
+	GLfloat s0 = texcoords[0], t0 = texcoords[1], s1 = texcoords[2], t1 = texcoords[3];
+
+	if (batch->clips) {
+		const SDL_Rect *clip = &batch->clip;
+
+		const GLfloat cx0 = max(x0, clip->x), cx1 = min(x1, clip->x + clip->w);
+		const GLfloat cy0 = max(y0, clip->y), cy1 = min(y1, clip->y + clip->h);
+
+		if (cx0 >= cx1 || cy0 >= cy1) {
+			return;
+		}
+
+		const GLfloat ds = (s1 - s0) / (x1 - x0), dt = (t1 - t0) / (y1 - y0);
+
+		s1 = s0 + (cx1 - x0) * ds;
+		s0 = s0 + (cx0 - x0) * ds;
+		t1 = t0 + (cy1 - y0) * dt;
+		t0 = t0 + (cy0 - y0) * dt;
+
+		x0 = cx0, x1 = cx1;
+		y0 = cy0, y1 = cy1;
+	}
+
+	RendererVertex *v = reserveVertexes(self, GL_QUADS, texture, 4);
+
+	v[0] = (RendererVertex) { .x = x0, .y = y0, .s = s0, .t = t0, .color = batch->color };
+	v[1] = (RendererVertex) { .x = x1, .y = y0, .s = s1, .t = t0, .color = batch->color };
+	v[2] = (RendererVertex) { .x = x1, .y = y1, .s = s1, .t = t1, .color = batch->color };
+	v[3] = (RendererVertex) { .x = x0, .y = y1, .s = s0, .t = t1, .color = batch->color };
+}
+
+/**
+ * @brief Sets the OpenGL scissor test to the given frame, or to the entire window, restricted to
+ * the damaged region being composited, if any.
+ */
+static void setScissor(const Renderer *self, const SDL_Rect *clippingFrame) {
+
+	SDL_Window *window = SDL_GL_GetCurrentWindow();
+
+	const SDL_Rect *target = self->composite->target;
+
+	SDL_Rect rect;
+	if (clippingFrame) {
+		rect = *clippingFrame;
+	} else if (target) {
+		rect = *target;
+	} else {
+		rect = MakeRect(0, 0, 0, 0);
+		SDL_GL_GetDrawableSize(window, &rect.w, &rect.h);
+	}
+
+	SDL_Rect transformed;
+	if (target) {
+		const double scale = MVC_WindowScale(window, NULL, NULL);
+
+		transformed = MakeRect((rect.x - target->x) * scale,
+							   (target->y + target->h - rect.y - rect.h) * scale,
+							   rect.w * scale,
+							   rect.h * scale);
+	} else {
+		transformed = MVC_TransformToWindow(window, &rect);
+	}
+
+	SDL_Rect scissor = MakeRect(transformed.x - 1, transformed.y - 1, transformed.w + 1, transformed.h + 1);
+
+	const SDL_Rect *damage = self->composite->scissor;
+	if (damage) {
+		if (SDL_IntersectRect(&scissor, damage, &scissor) == false) {
+			scissor = MakeRect(0, 0, 0, 0);
+		}
+	}
+
+	glScissor(scissor.x, scissor.y, scissor.w, scissor.h);
+}
+
+#pragma mark - Framebuffers
+
+/**
+ * @brief Resolves the framebuffer object entry point with the given name, falling back to the
+ * `EXT_framebuffer_object` variant.
+ */
+static void *compositeProcAddress(const char *name) {
+
+	void *proc = SDL_GL_GetProcAddress(name);
+	if (proc == NULL) {
+		char ext[64];
+		snprintf(ext, sizeof(ext), "%sEXT", name);
+		proc = SDL_GL_GetProcAddress(ext);
+	}
+
+	return proc;
+}
+
+/**
+ * @brief Resolves the framebuffer object entry points for the current context.
+ * @return True if framebuffer objects are supported, false otherwise.
+ */
+static _Bool loadFramebufferProcs(struct RendererComposite *composite) {
+
+	if (composite->unsupported) {
+		return false;
+	}
+
+	if (composite->GenFramebuffers == NULL) {
+		composite->GenFramebuffers = compositeProcAddress("glGenFramebuffers");
+		composite->DeleteFramebuffers = compositeProcAddress("glDeleteFramebuffers");
+		composite->BindFramebuffer = compositeProcAddress("glBindFramebuffer");
+		composite->FramebufferTexture2D = compositeProcAddress("glFramebufferTexture2D");
+		composite->CheckFramebufferStatus = compositeProcAddress("glCheckFramebufferStatus");
+		composite->BlendFuncSeparate = compositeProcAddress("glBlendFuncSeparate");
+
+		if (composite->GenFramebuffers == NULL ||
+			composite->DeleteFramebuffers == NULL ||
+			composite->BindFramebuffer == NULL ||
+			composite->FramebufferTexture2D == NULL ||
+			composite->CheckFramebufferStatus == NULL ||
+			composite->BlendFuncSeparate == NULL) {
+
+			MVC_LogWarn("Framebuffer objects are not supported\n");
+			composite->unsupported = true;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief Sets the blend function for the current render target.
+ * @remarks Offscreen targets accumulate premultiplied color, and coverage, so that they blend
+ * correctly when they are themselves drawn.
+ */
+static void setBlendFunc(const Renderer *self) {
+
+	if (self->composite->offscreen) {
+		self->composite->BlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+	} else {
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	}
+}
+
+#pragma mark - Rasterization
+
+static void renderView(Renderer *self, View *view);
+
+/**
+ * @brief Comparator for sorting Views by depth (Painter's Algorithm), and then by hierarchy order.
+ */
+static int render_sort(const void *a, const void *b) {
+
+	const RendererDrawItem *itemA = (const RendererDrawItem *) a;
+	const RendererDrawItem *itemB = (const RendererDrawItem *) b;
+
+	if (itemA->depth != itemB->depth) {
+		return itemA->depth - itemB->depth;
+	}
+
+	return itemA->index < itemB->index ? -1 : 1;
+}
+
+/**
+ * @brief Renders the given View and its visible descendants, sorted by depth, with the current
+ * render target.
+ */
+static void renderSubtree(Renderer *self, View *view) {
+
+	struct RendererDrawList *drawList = self->drawList;
+	struct RendererDrawList subtree = { 0 };
+
+	self->drawList = &subtree;
+
+	const int depth = $(view, depth);
+
+	$(self, addView, view, depth);
+
+	const Array *subviews = (Array *) view->subviews;
+	for (size_t i = 0; i < subviews->count; i++) {
+		View *subview = $(subviews, objectAtIndex, i);
+		$(subview, draw, self);
+	}
+
+	self->drawList = drawList;
+
+	qsort(subtree.items, subtree.count, sizeof(RendererDrawItem), render_sort);
+
+	for (size_t i = 0; i < subtree.count; i++) {
+		View *item = subtree.items[i].view;
+
+		const SDL_Rect clippingFrame = $(item, clippingFrame);
+		if (clippingFrame.w && clippingFrame.h) {
+
+			$(self, setClippingFrame, &clippingFrame);
+
+			if (item == view) {
+				$(view, render, self);
+			} else {
+				renderView(self, item);
+			}
+		}
+	}
+
+	free(subtree.items);
+	free(subtree.previousItems);
+}
+
+/**
+ * @brief Redraws the cached rasterization of the given View, covering the given frame.
+ * @return True on success, false if the View could not be rasterized.
+ */
+static _Bool rasterize(Renderer *self, View *view, const SDL_Rect *frame) {
+
+	struct RendererComposite *composite = self->composite;
+
+	if (loadFramebufferProcs(composite) == false) {
+		return false;
+	}
+
+	const double scale = MVC_WindowScale(NULL, NULL, NULL);
+	const int w = frame->w * scale, h = frame->h * scale;
+
+	GLint maxSize;
+	glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+
+	if (w > maxSize || h > maxSize) {
+		return false;
+	}
+
+	$(self, flush);
+
+	if (view->rasterTexture == 0) {
+		glGenTextures(1, &view->rasterTexture);
+	}
+
+	glBindTexture(GL_TEXTURE_2D, view->rasterTexture);
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+
+	if (composite->rasterFramebuffer == 0) {
+		composite->GenFramebuffers(1, &composite->rasterFramebuffer);
+	}
+
+	GLint framebuffer, viewport[4];
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+	glGetIntegerv(GL_VIEWPORT, viewport);
+
+	GLfloat clearColor[4];
+	glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+
+	const GLuint texture = composite->rasterTexture;
+
+	composite->BindFramebuffer(GL_FRAMEBUFFER, composite->rasterFramebuffer);
+	composite->FramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, view->rasterTexture, 0);
+	composite->rasterTexture = view->rasterTexture;
+
+	const GLenum status = composite->CheckFramebufferStatus(GL_FRAMEBUFFER);
+	if (status == GL_FRAMEBUFFER_COMPLETE) {
+
+		const SDL_Rect *target = composite->target;
+		const SDL_Rect *scissor = composite->scissor;
+
+		composite->target = frame;
+		composite->scissor = NULL;
+
+		glMatrixMode(GL_PROJECTION);
+		glPushMatrix();
+		glLoadIdentity();
+		glOrtho(frame->x, frame->x + frame->w, frame->y + frame->h, frame->y, -1.0, 1.0);
+		glMatrixMode(GL_MODELVIEW);
+
+		glViewport(0, 0, w, h);
+
+		glScissor(0, 0, w, h);
+		glClearColor(0.0, 0.0, 0.0, 0.0);
+		glClear(GL_COLOR_BUFFER_BIT);
+
+		if (self->batchesDrawCalls) {
+			setScissor(self, NULL);
+		}
+
+		composite->offscreen++;
+		setBlendFunc(self);
+
+		const SDL_Color color = self->batch->color;
+
+		renderSubtree(self, view);
+
+		$(self, flush);
+
+		$(self, setDrawColor, &color);
+
+		composite->offscreen--;
+		setBlendFunc(self);
+
+		glMatrixMode(GL_PROJECTION);
+		glPopMatrix();
+		glMatrixMode(GL_MODELVIEW);
+
+		composite->target = target;
+		composite->scissor = scissor;
+	} else {
+		MVC_LogError("Incomplete framebuffer: %d\n", status);
+	}
+
+	if (framebuffer == (GLint) composite->rasterFramebuffer) {
+		composite->FramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+		composite->rasterTexture = texture;
+	} else {
+		composite->BindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	}
+
+	glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+	glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+
+	if (self->batchesDrawCalls) {
+		setScissor(self, NULL);
+	}
+
+	return status == GL_FRAMEBUFFER_COMPLETE;
+}
+
+/**
+ * @brief Renders the cached rasterization of the given View, redrawing it if necessary.
+ * @remarks If the View can not be rasterized, it and its descendants are rendered directly.
+ */
+static void renderRaster(Renderer *self, View *view) {
+
+	const SDL_Rect clippingFrame = $(view, clippingFrame);
+	const SDL_Rect renderFrame = $(view, renderFrame);
+
+	const SDL_Rect frame = MakeRect(clippingFrame.x - renderFrame.x,
+									clippingFrame.y - renderFrame.y,
+									clippingFrame.w,
+									clippingFrame.h);
+
+	if (view->rasterTexture == 0 || SDL_RectEquals(&view->rasterFrame, &frame) == false) {
+
+		if (rasterize(self, view, &clippingFrame) == false) {
+			view->rasterFrame = MakeRect(0, 0, 0, 0);
+
+			renderSubtree(self, view);
+			return;
+		}
+
+		view->rasterFrame = frame;
+
+		$(self, setClippingFrame, &clippingFrame);
+	}
+
+	const GLfloat texcoords[] = { 0.0, 1.0, 1.0, 0.0 };
+	const SDL_Color color = self->batch->color;
+
+	$(self, flush);
+
+	glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+	$(self, setDrawColor, &Colors.White);
+	$(self, drawTextureRegion, view->rasterTexture, texcoords, &clippingFrame);
+	$(self, flush);
+
+	$(self, setDrawColor, &color);
+
+	setBlendFunc(self);
+}
+
+/**
+ * @brief Renders the given View, or its cached rasterization if it `rasterizes`.
+ */
+static void renderView(Renderer *self, View *view) {
+
+	if (view->rasterizes) {
+		renderRaster(self, view);
+	} else {
+		$(view, render, self);
+	}
+}
+
+#pragma mark - Compositing
+
+/**
+ * @brief Creates or resizes the offscreen framebuffer to match the drawable size of the window.
+ * @return True if the framebuffer is ready for drawing, false if it is not supported.
+ */
+static _Bool createComposite(Renderer *self) {
+
+	struct RendererComposite *composite = self->composite;
+
+	if (loadFramebufferProcs(composite) == false) {
+		return false;
+	}
+
+	int w, h;
+	SDL_GL_GetDrawableSize(SDL_GL_GetCurrentWindow(), &w, &h);
+
+	if (composite->framebuffer && composite->w == w && composite->h == h) {
+		return true;
+	}
+
+	if (composite->framebuffer) {
+		composite->DeleteFramebuffers(1, &composite->framebuffer);
+		glDeleteTextures(1, &composite->texture);
+	}
+
+	composite->w = w;
+	composite->h = h;
+	composite->valid = false;
+
+	glGenTextures(1, &composite->texture);
+	glBindTexture(GL_TEXTURE_2D, composite->texture);
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+
+	GLint framebuffer;
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+
+	composite->GenFramebuffers(1, &composite->framebuffer);
+	composite->BindFramebuffer(GL_FRAMEBUFFER, composite->framebuffer);
+	composite->FramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, composite->texture, 0);
+
+	const GLenum status = composite->CheckFramebufferStatus(GL_FRAMEBUFFER);
+
+	composite->BindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+
+	if (status != GL_FRAMEBUFFER_COMPLETE) {
+		MVC_LogError("Incomplete framebuffer: %d, compositing is disabled\n", status);
+
+		composite->DeleteFramebuffers(1, &composite->framebuffer);
+		glDeleteTextures(1, &composite->texture);
+
+		composite->framebuffer = composite->texture = 0;
+		composite->unsupported = true;
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Adds the given rectangle, in window coordinates, to the damaged regions, merging it with
+ * any regions it overlaps.
+ * @remarks The rectangle is grown by one point to account for the slop in Renderer clipping.
+ */
+static void damageRect(struct RendererComposite *composite, const SDL_Rect *rect) {
+
+	if (rect->w <= 0 || rect->h <= 0) {
+		return;
+	}
+
+	SDL_Rect damage = MakeRect(rect->x - 1, rect->y - 1, rect->w + 2, rect->h + 2);
+
+	for (size_t i = 0; i < composite->numDamage;) {
+		if (SDL_HasIntersection(&damage, &composite->damage[i])) {
+			SDL_UnionRect(&damage, &composite->damage[i], &damage);
+			composite->damage[i] = composite->damage[--composite->numDamage];
+			i = 0;
+		} else {
+			i++;
+		}
+	}
+
+	if (composite->numDamage == lengthof(composite->damage)) {
+		for (size_t i = 0; i < composite->numDamage; i++) {
+			SDL_UnionRect(&damage, &composite->damage[i], &damage);
+		}
+		composite->numDamage = 0;
+	}
+
+	composite->damage[composite->numDamage++] = damage;
+}
+
+/**
+ * @brief Accumulates the damaged regions for the current frame by comparing the Views added to
+ * the previous frame.
+ * @param changed True if the set of Views, or their depths, changed since the previous frame.
+ */
+static void damageViews(Renderer *self, _Bool changed) {
+
+	struct RendererComposite *composite = self->composite;
+	struct RendererDrawList *drawList = self->drawList;
+
+	for (size_t i = 0; i < drawList->count; i++) {
+		drawList->items[i].frame = $(drawList->items[i].view, clippingFrame);
+	}
+
+	if (changed || composite->valid == false) {
+
+		int w, h;
+		SDL_GetWindowSize(SDL_GL_GetCurrentWindow(), &w, &h);
+
+		composite->damage[0] = MakeRect(0, 0, w, h);
+		composite->numDamage = 1;
+	}
+
+	if (changed) {
+		return;
+	}
+
+	for (size_t i = 0; i < drawList->count; i++) {
+		const RendererDrawItem *item = &drawList->items[i];
+		RendererDrawItem *previousItem = &drawList->previousItems[i];
+
+		if (item->needsDisplay || SDL_RectEquals(&item->frame, &previousItem->frame) == false) {
+			damageRect(composite, &previousItem->frame);
+			damageRect(composite, &item->frame);
+		}
+
+		previousItem->frame = item->frame;
+	}
+}
+
+/**
+ * @brief Redraws the damaged regions of the offscreen framebuffer.
+ */
+static void renderComposite(Renderer *self) {
+
+	struct RendererComposite *composite = self->composite;
+
+	SDL_Window *window = SDL_GL_GetCurrentWindow();
+
+	GLint framebuffer, viewport[4];
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+	glGetIntegerv(GL_VIEWPORT, viewport);
+
+	GLfloat clearColor[4];
+	glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+
+	composite->BindFramebuffer(GL_FRAMEBUFFER, composite->framebuffer);
+
+	glViewport(0, 0, composite->w, composite->h);
+	glClearColor(0.0, 0.0, 0.0, 0.0);
+
+	composite->offscreen++;
+	setBlendFunc(self);
+
+	const Array *views = (Array *) self->views;
+
+	for (size_t i = 0; i < composite->numDamage; i++) {
+		const SDL_Rect *damage = &composite->damage[i];
+
+		const SDL_Rect scissor = MVC_TransformToWindow(window, damage);
+		composite->scissor = &scissor;
+
+		glScissor(scissor.x, scissor.y, scissor.w, scissor.h);
+		glClear(GL_COLOR_BUFFER_BIT);
+
+		for (size_t j = 0; j < views->count; j++) {
+			View *view = $(views, objectAtIndex, j);
+
+			const SDL_Rect clippingFrame = $(view, clippingFrame);
+			if (clippingFrame.w && clippingFrame.h) {
+
+				const SDL_Rect bounds = MakeRect(clippingFrame.x - 1,
+												 clippingFrame.y - 1,
+												 clippingFrame.w + 2,
+												 clippingFrame.h + 2);
+
+				if (SDL_HasIntersection(&bounds, damage)) {
+
+					$(self, setClippingFrame, &clippingFrame);
+
+					renderView(self, view);
+				}
+			}
+		}
+
+		$(self, flush);
+
+		composite->scissor = NULL;
+	}
+
+	composite->numDamage = 0;
+	composite->valid = true;
+
+	composite->offscreen--;
+	setBlendFunc(self);
+
+	glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+	glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+
+	composite->BindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+
+	if (self->batchesDrawCalls) {
+		setScissor(self, NULL);
+	}
+}
+
+
+#pragma mark - Texture uploads
+
+/**
+ * @brief Removes the upload at the given index, deleting its texture if it was not retrieved.
+ */
+static void removeUpload(struct RendererUploadQueue *queue, size_t index) {
+
+	RendererUpload *upload = &queue->uploads[index];
+
+	if (upload->texture) {
+		glDeleteTextures(1, &upload->texture);
+	}
+
+	release(upload->view);
+	SDL_FreeSurface(upload->surface);
+
+	queue->uploads[index] = queue->uploads[--queue->count];
+}
+
+/**
+ * @brief Uploads the given surface, accounting for it in the current frame's statistics.
+ */
+static GLuint uploadTexture(Renderer *self, SDL_Surface *surface) {
+
+	const GLuint texture = $(self, createTexture, surface);
+	if (texture) {
+		self->uploads->statistics.uploaded++;
+		self->uploads->statistics.uploadedBytes += surface->pitch * surface->h;
+	}
+
+	return texture;
+}
+
+/**
+ * @return True if a texture of the given size fits within the current frame's upload budget.
+ */
+static _Bool withinUploadBudget(const Renderer *self, size_t bytes) {
+
+	const RendererUploadStatistics *statistics = &self->uploads->statistics;
+
+	if (self->uploadBudget == 0 || statistics->uploaded == 0) {
+		return true;
+	}
+
+	return statistics->uploadedBytes + bytes <= self->uploadBudget;
+}
+
+/**
+ * @brief qsort comparator for uploads, largest on screen first.
+ */
+static int uploadTextures_sort(const void *a, const void *b) {
+	return ((const RendererUpload *) b)->area - ((const RendererUpload *) a)->area;
+}
+
+/**
+ * @brief Discards uploads which were not requested during the previous frame, and uploads the
+ * remainder in priority order until the budget is spent.
+ */
+static void uploadTextures(Renderer *self) {
+
+	struct RendererUploadQueue *queue = self->uploads;
+
+	memset(&queue->statistics, 0, sizeof(queue->statistics));
+
+	for (size_t i = 0; i < queue->count;) {
+		if (queue->uploads[i].isRequested) {
+			queue->uploads[i++].isRequested = false;
+		} else {
+			removeUpload(queue, i);
+		}
+	}
+
+	qsort(queue->uploads, queue->count, sizeof(RendererUpload), uploadTextures_sort);
+
+	for (size_t i = 0; i < queue->count; i++) {
+
+		RendererUpload *upload = &queue->uploads[i];
+		if (upload->texture) {
+			continue;
+		}
+
+		if (withinUploadBudget(self, upload->bytes) == false) {
+			break;
+		}
+
+		upload->texture = uploadTexture(self, upload->surface);
+	}
+}
+
+#pragma mark - Atlas
 
 /**
- * @see Object::dealloc(Object *)
+ * @return The hash bucket for the given surface.
  */
-static void dealloc(Object *self) {
+static int *atlasBucket(struct RendererAtlas *atlas, const SDL_Surface *surface) {
+	return &atlas->buckets[((uintptr_t) surface >> 4) % lengthof(atlas->buckets)];
+}
 
-	Renderer *this = (Renderer *) self;
+/**
+ * @brief Rebuilds the hash buckets of the given atlas, after entries have been added or removed.
+ */
+static void indexAtlas(struct RendererAtlas *atlas) {
 
-	release(this->views);
+	for (size_t i = 0; i < lengthof(atlas->buckets); i++) {
+		atlas->buckets[i] = -1;
+	}
 
-	super(Object, self, dealloc);
+	for (size_t i = 0; i < atlas->count; i++) {
+
+		RendererAtlasEntry *entry = &atlas->entries[i];
+		int *bucket = atlasBucket(atlas, entry->surface);
+
+		entry->bucketNext = *bucket;
+		*bucket = (int) i;
+	}
+}
+
+/**
+ * @return The entry for the given surface, or `NULL`.
+ */
+static const RendererAtlasEntry *atlasEntry(struct RendererAtlas *atlas, const SDL_Surface *surface) {
+
+	for (int i = *atlasBucket(atlas, surface); i != -1; i = atlas->entries[i].bucketNext) {
+		if (atlas->entries[i].surface == surface) {
+			return &atlas->entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Reserves a region of the given size in the shared atlas, adding a page if necessary.
+ * @return The page.
+ */
+static RendererAtlasPage *packAtlas(struct RendererAtlas *atlas, int w, int h, SDL_Rect *rect) {
+
+	RendererAtlasPage *page = atlas->numPages ? atlas->pages[atlas->numPages - 1] : NULL;
+	if (page) {
+		if (page->x + w + 1 > DEFAULT_RENDERER_ATLAS_SIZE) {
+			page->x = 0;
+			page->y += page->shelfHeight;
+			page->shelfHeight = 0;
+		}
+		if (page->y + h + 1 > DEFAULT_RENDERER_ATLAS_SIZE) {
+			page = NULL;
+		}
+	}
+
+	if (page == NULL) {
+		page = calloc(1, sizeof(RendererAtlasPage));
+		assert(page);
+
+		glGenTextures(1, &page->texture);
+		glBindTexture(GL_TEXTURE_2D, page->texture);
+
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_FALSE);
+
+		GLubyte *pixels = calloc(DEFAULT_RENDERER_ATLAS_SIZE * DEFAULT_RENDERER_ATLAS_SIZE, 4);
+		assert(pixels);
+
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, DEFAULT_RENDERER_ATLAS_SIZE, DEFAULT_RENDERER_ATLAS_SIZE, 0,
+					 GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+
+		free(pixels);
+
+		atlas->pages = realloc(atlas->pages, ++atlas->numPages * sizeof(RendererAtlasPage *));
+		assert(atlas->pages);
+
+		atlas->pages[atlas->numPages - 1] = page;
+	}
+
+	*rect = MakeRect(page->x, page->y, w, h);
+
+	page->x += w + 1;
+	page->shelfHeight = max(page->shelfHeight, h + 1);
+
+	page->count++;
+	return page;
+}
+
+/**
+ * @brief Evicts atlas entries whose surfaces have been freed by all other owners, and the pages
+ * which no longer hold any entries.
+ */
+static void sweepAtlas(struct RendererAtlas *atlas) {
+
+	const size_t count = atlas->count;
+
+	for (size_t i = 0; i < atlas->count;) {
+
+		RendererAtlasEntry *entry = &atlas->entries[i];
+		if (entry->surface->refcount > 1) {
+			i++;
+			continue;
+		}
+
+		entry->page->count--;
+
+		SDL_FreeSurface(entry->surface);
+		atlas->entries[i] = atlas->entries[--atlas->count];
+	}
+
+	if (atlas->count != count) {
+		indexAtlas(atlas);
+	}
+
+	for (size_t i = 0; i < atlas->numPages;) {
+
+		RendererAtlasPage *page = atlas->pages[i];
+		if (page->count) {
+			i++;
+			continue;
+		}
+
+		glDeleteTextures(1, &page->texture);
+		free(page);
+
+		memmove(atlas->pages + i, atlas->pages + i + 1, (--atlas->numPages - i) * sizeof(RendererAtlasPage *));
+	}
+}
+
+/**
+ * @brief Discards the shared atlas, whose textures have been invalidated.
+ */
+static void clearAtlas(struct RendererAtlas *atlas) {
+
+	for (size_t i = 0; i < atlas->count; i++) {
+		SDL_FreeSurface(atlas->entries[i].surface);
+	}
+
+	for (size_t i = 0; i < atlas->numPages; i++) {
+		free(atlas->pages[i]);
+	}
+
+	atlas->count = atlas->numPages = 0;
+
+	indexAtlas(atlas);
 }
 
 #pragma mark - Renderer
 
 /**
- * @fn void Renderer::addView(Renderer *self, View *view)
+ * @fn void Renderer::addView(Renderer *self, View *view, int depth)
  * @memberof Renderer
  */
-static void addView(Renderer *self, View *view) {
-	$(self->views, addObject, view);
+static void addView(Renderer *self, View *view, int depth) {
+
+	struct RendererDrawList *drawList = self->drawList;
+
+	if (drawList->count == drawList->capacity) {
+		drawList->capacity = drawList->capacity ? drawList->capacity << 1 : 64;
+
+		drawList->items = realloc(drawList->items, drawList->capacity * sizeof(RendererDrawItem));
+		assert(drawList->items);
+
+		drawList->previousItems = realloc(drawList->previousItems, drawList->capacity * sizeof(RendererDrawItem));
+		assert(drawList->previousItems);
+	}
+
+	drawList->items[drawList->count] = (RendererDrawItem) {
+		.view = view,
+		.depth = depth,
+		.index = drawList->count,
+		.needsDisplay = view->needsDisplay || (view->rasterizes && view->descendantsNeedDisplay)
+	};
+
+	drawList->count++;
 }
 
 /**
@@ -59,6 +1341,14 @@ static void addView(Renderer *self, View *view) {
  */
 static void beginFrame(Renderer *self) {
 
+	$$(Font, uploadGlyphs);
+
+	$$(Image, dispatchCompletions);
+
+	sweepAtlas(self->atlas);
+
+	uploadTextures(self);
+
 	glEnable(GL_BLEND);
 	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
@@ -67,6 +1357,10 @@ static void beginFrame(Renderer *self) {
 	glEnableClientState(GL_VERTEX_ARRAY);
 	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
 
+	if (self->batchesDrawCalls) {
+		setScissor(self, NULL);
+	}
+
 	$(self, setDrawColor, &Colors.White);
 }
 
@@ -127,9 +1421,14 @@ static void drawLines(const Renderer *self, const SDL_Point *points, size_t coun
 
 	assert(points);
 
-	glVertexPointer(2, GL_INT, 0, points);
-
-	glDrawArrays(GL_LINE_STRIP, 0, (GLsizei) count);
+	if (self->batchesDrawCalls) {
+		for (size_t i = 1; i < count; i++) {
+			batchLine(self, &points[i - 1], &points[i]);
+		}
+	} else {
+		glVertexPointer(2, GL_INT, 0, points);
+		glDrawArrays(GL_LINE_STRIP, 0, (GLsizei) count);
+	}
 }
 
 /**
@@ -140,6 +1439,20 @@ static void drawRect(const Renderer *self, const SDL_Rect *rect) {
 
 	assert(rect);
 
+	if (self->batchesDrawCalls) {
+		const SDL_Point points[] = {
+			{ rect->x, rect->y },
+			{ rect->x + rect->w, rect->y },
+			{ rect->x + rect->w, rect->y + rect->h },
+			{ rect->x, rect->y + rect->h }
+		};
+
+		for (size_t i = 0; i < lengthof(points); i++) {
+			batchLine(self, &points[i], &points[(i + 1) % lengthof(points)]);
+		}
+		return;
+	}
+
 	GLint verts[8];
 
 	verts[0] = rect->x;
@@ -166,7 +1479,12 @@ static void drawRectFilled(const Renderer *self, const SDL_Rect *rect) {
 
 	assert(rect);
 
-	glRecti(rect->x - 1, rect->y - 1, rect->x + rect->w + 1, rect->y + rect->h + 1);
+	if (self->batchesDrawCalls) {
+		const GLfloat texcoords[] = { 0.0, 0.0, 1.0, 1.0 };
+		batchQuad(self, 0, texcoords, rect->x - 1, rect->y - 1, rect->x + rect->w + 1, rect->y + rect->h + 1);
+	} else {
+		glRecti(rect->x - 1, rect->y - 1, rect->x + rect->w + 1, rect->y + rect->h + 1);
+	}
 }
 
 /**
@@ -175,13 +1493,30 @@ static void drawRectFilled(const Renderer *self, const SDL_Rect *rect) {
  */
 static void drawTexture(const Renderer *self, GLuint texture, const SDL_Rect *rect) {
 
+	const GLfloat texcoords[] = { 0.0, 0.0, 1.0, 1.0 };
+
+	$(self, drawTextureRegion, texture, texcoords, rect);
+}
+
+/**
+ * @fn void Renderer::drawTextureRegion(const Renderer *self, GLuint texture, const GLfloat *texcoords, const SDL_Rect *dest)
+ * @memberof Renderer
+ */
+static void drawTextureRegion(const Renderer *self, GLuint texture, const GLfloat *texcoords, const SDL_Rect *rect) {
+
+	assert(texcoords);
 	assert(rect);
 
-	const GLfloat texcoords[] = {
-		0.0, 0.0,
-		1.0, 0.0,
-		1.0, 1.0,
-		0.0, 1.0
+	if (self->batchesDrawCalls) {
+		batchQuad(self, texture, texcoords, rect->x, rect->y, rect->x + rect->w, rect->y + rect->h);
+		return;
+	}
+
+	const GLfloat coords[] = {
+		texcoords[0], texcoords[1],
+		texcoords[2], texcoords[1],
+		texcoords[2], texcoords[3],
+		texcoords[0], texcoords[3]
 	};
 
 	GLint verts[8];
@@ -202,21 +1537,93 @@ static void drawTexture(const Renderer *self, GLuint texture, const SDL_Rect *re
 	glBindTexture(GL_TEXTURE_2D, texture);
 
 	glVertexPointer(2, GL_INT, 0, verts);
-	glTexCoordPointer(2, GL_FLOAT, 0, texcoords);
+	glTexCoordPointer(2, GL_FLOAT, 0, coords);
 
 	glDrawArrays(GL_QUADS, 0, 4);
 
 	glDisable(GL_TEXTURE_2D);
 }
 
+/**
+ * @fn void Renderer::drawTextureRegions(const Renderer *self, GLuint texture, const GLfloat *texcoords, const SDL_Rect *dest, size_t count)
+ * @memberof Renderer
+ */
+static void drawTextureRegions(const Renderer *self, GLuint texture, const GLfloat *texcoords, const SDL_Rect *rects, size_t count) {
+
+	assert(texcoords);
+	assert(rects);
+
+	if (self->batchesDrawCalls) {
+		for (size_t i = 0; i < count; i++) {
+			const SDL_Rect *rect = &rects[i];
+			batchQuad(self, texture, &texcoords[i * 4], rect->x, rect->y, rect->x + rect->w, rect->y + rect->h);
+		}
+		return;
+	}
+
+	GLint verts[RENDERER_REGIONS_PER_DRAW * 8];
+	GLfloat coords[RENDERER_REGIONS_PER_DRAW * 8];
+
+	glEnable(GL_TEXTURE_2D);
+	glBindTexture(GL_TEXTURE_2D, texture);
+
+	glVertexPointer(2, GL_INT, 0, verts);
+	glTexCoordPointer(2, GL_FLOAT, 0, coords);
+
+	for (size_t i = 0; i < count;) {
+
+		const size_t n = min(count - i, (size_t) RENDERER_REGIONS_PER_DRAW);
+		for (size_t j = 0; j < n; j++, i++) {
+
+			const GLfloat *t = &texcoords[i * 4];
+			const SDL_Rect *rect = &rects[i];
+
+			GLint *v = &verts[j * 8];
+			GLfloat *c = &coords[j * 8];
+
+			v[0] = rect->x;           v[1] = rect->y;
+			v[2] = rect->x + rect->w; v[3] = rect->y;
+			v[4] = rect->x + rect->w; v[5] = rect->y + rect->h;
+			v[6] = rect->x;           v[7] = rect->y + rect->h;
+
+			c[0] = t[0]; c[1] = t[1];
+			c[2] = t[2]; c[3] = t[1];
+			c[4] = t[2]; c[5] = t[3];
+			c[6] = t[0]; c[7] = t[3];
+		}
+
+		glDrawArrays(GL_QUADS, 0, (GLsizei) n * 4);
+	}
+
+	glDisable(GL_TEXTURE_2D);
+}
+
 /**
  * @fn void Renderer::endFrame(Renderer *self)
  * @memberof Renderer
  */
 static void endFrame(Renderer *self) {
 
+	$(self, flush);
+
 	$(self, setDrawColor, &Colors.White);
 
+	if ($(self, isCompositeValid)) {
+
+		$(self, setClippingFrame, NULL);
+
+		int w, h;
+		SDL_GetWindowSize(SDL_GL_GetCurrentWindow(), &w, &h);
+
+		const SDL_Rect rect = MakeRect(0, 0, w, h);
+		const GLfloat texcoords[] = { 0.0, 1.0, 1.0, 0.0 };
+
+		glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+		$(self, drawTextureRegion, self->composite->texture, texcoords, &rect);
+		$(self, flush);
+	}
+
 	glDisableClientState(GL_VERTEX_ARRAY);
 	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
 
@@ -233,6 +1640,41 @@ static void endFrame(Renderer *self) {
 	}
 }
 
+/**
+ * @fn void Renderer::flush(const Renderer *self)
+ * @memberof Renderer
+ */
+static void flush(const Renderer *self) {
+
+	struct RendererBatch *batch = self->batch;
+	if (batch->count == 0) {
+		return;
+	}
+
+	if (batch->texture) {
+		glEnable(GL_TEXTURE_2D);
+		glBindTexture(GL_TEXTURE_2D, batch->texture);
+	}
+
+	glEnableClientState(GL_COLOR_ARRAY);
+
+	glVertexPointer(2, GL_FLOAT, sizeof(RendererVertex), &batch->vertexes->x);
+	glTexCoordPointer(2, GL_FLOAT, sizeof(RendererVertex), &batch->vertexes->s);
+	glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(RendererVertex), &batch->vertexes->color);
+
+	glDrawArrays(batch->mode, 0, (GLsizei) batch->count);
+
+	glDisableClientState(GL_COLOR_ARRAY);
+
+	if (batch->texture) {
+		glDisable(GL_TEXTURE_2D);
+	}
+
+	glColor4ubv((const GLubyte *) &batch->color);
+
+	batch->count = 0;
+}
+
 /**
  * @fn Renderer *Renderer::init(Renderer *self)
  * @memberof Renderer
@@ -241,22 +1683,38 @@ static Renderer *init(Renderer *self) {
 
 	self = (Renderer *) super(Object, self, init);
 	if (self) {
+		self->batch = calloc(1, sizeof(struct RendererBatch));
+		assert(self->batch);
+
+		self->composite = calloc(1, sizeof(struct RendererComposite));
+		assert(self->composite);
+
+		self->drawList = calloc(1, sizeof(struct RendererDrawList));
+		assert(self->drawList);
+
 		self->views = $$(MutableArray, array);
 		assert(self->views);
+
+		self->uploads = calloc(1, sizeof(struct RendererUploadQueue));
+		assert(self->uploads);
+
+		self->uploadBudget = DEFAULT_RENDERER_UPLOAD_BUDGET;
+
+		self->atlas = calloc(1, sizeof(struct RendererAtlas));
+		assert(self->atlas);
+
+		indexAtlas(self->atlas);
 	}
 
 	return self;
 }
 
 /**
- * @brief Comparator for sorting Views by depth (Painter's Algorithm).
+ * @fn _Bool Renderer::isCompositeValid(const Renderer *self)
+ * @memberof Renderer
  */
-static Order render_sort(const ident a, const ident b) {
-
-	const int depthA = $((const View *) a, depth);
-	const int depthB = $((const View *) b, depth);
-
-	return (Order) depthA - depthB;
+static _Bool isCompositeValid(const Renderer *self) {
+	return self->compositesViews && self->composite->valid;
 }
 
 /**
@@ -273,7 +1731,7 @@ static void render_renderView(const Array *array, ident obj, ident data) {
 
 		$(renderer, setClippingFrame, &clippingFrame);
 
-		$(view, render, renderer);
+		renderView(renderer, view);
 	}
 }
 
@@ -283,11 +1741,44 @@ static void render_renderView(const Array *array, ident obj, ident data) {
  */
 static void render(Renderer *self) {
 
-	$(self->views, sort, render_sort);
+	struct RendererDrawList *drawList = self->drawList;
 
-	$((Array *) self->views, enumerateObjects, render_renderView, self);
+	_Bool changed = drawList->count != drawList->previousCount;
+	for (size_t i = 0; i < drawList->count && changed == false; i++) {
+		const RendererDrawItem *item = &drawList->items[i], *previousItem = &drawList->previousItems[i];
+		changed = item->view != previousItem->view || item->depth != previousItem->depth;
+	}
+
+	const _Bool composites = self->compositesViews && createComposite(self);
+	if (composites) {
+		damageViews(self, changed);
+	} else {
+		self->composite->valid = false;
+	}
+
+	if (changed) {
+
+		memcpy(drawList->previousItems, drawList->items, drawList->count * sizeof(RendererDrawItem));
+		drawList->previousCount = drawList->count;
+
+		qsort(drawList->items, drawList->count, sizeof(RendererDrawItem), render_sort);
+
+		$(self->views, removeAllObjects);
 
-	$(self->views, removeAllObjects);
+		for (size_t i = 0; i < drawList->count; i++) {
+			$(self->views, addObject, drawList->items[i].view);
+		}
+	}
+
+	drawList->count = 0;
+
+	if (composites) {
+		renderComposite(self);
+	} else {
+		$((Array *) self->views, enumerateObjects, render_renderView, self);
+
+		$(self, flush);
+	}
 }
 
 /**
@@ -296,27 +1787,180 @@ static void render(Renderer *self) {
  */
 static void renderDeviceDidReset(Renderer *self) {
 
+	struct RendererComposite *composite = self->composite;
+
+	composite->framebuffer = composite->texture = 0;
+	composite->rasterFramebuffer = composite->rasterTexture = 0;
+	composite->w = composite->h = 0;
+	composite->valid = composite->unsupported = false;
+
+	composite->GenFramebuffers = NULL;
+
+	for (size_t i = 0; i < self->uploads->count; i++) {
+		self->uploads->uploads[i].texture = 0;
+	}
+
+	clearAtlas(self->atlas);
+
+	$$(Font, renderDeviceDidResetFonts);
 }
 
 /**
- * @fn void Renderer::setClippingFrame(Renderer *self, const SDL_Rect *clippingFrame)
+ * @fn GLuint Renderer::requestTexture(Renderer *self, View *view, SDL_Surface *surface)
  * @memberof Renderer
  */
-static void setClippingFrame(Renderer *self, const SDL_Rect *clippingFrame) {
+static GLuint requestTexture(Renderer *self, View *view, SDL_Surface *surface) {
 
-	SDL_Window *window = SDL_GL_GetCurrentWindow();
+	assert(view);
+	assert(surface);
 
-	SDL_Rect rect;
-	if (clippingFrame) {
-		rect = *clippingFrame;
-	} else {
-		rect = MakeRect(0, 0, 0, 0);
-		SDL_GL_GetDrawableSize(window, &rect.w, &rect.h);
+	struct RendererUploadQueue *queue = self->uploads;
+
+	const SDL_Rect clippingFrame = $(view, clippingFrame);
+	const int area = clippingFrame.w * clippingFrame.h;
+
+	for (size_t i = 0; i < queue->count; i++) {
+
+		RendererUpload *upload = &queue->uploads[i];
+		if (upload->view == view && upload->surface == surface) {
+
+			const GLuint texture = upload->texture;
+			if (texture) {
+				upload->texture = 0;
+				removeUpload(queue, i);
+				return texture;
+			}
+
+			upload->area = area;
+			upload->isRequested = true;
+
+			$(view, setNeedsDisplay);
+			return 0;
+		}
+	}
+
+	const size_t bytes = surface->pitch * surface->h;
+
+	if (withinUploadBudget(self, bytes)) {
+		return uploadTexture(self, surface);
+	}
+
+	if (queue->count == queue->capacity) {
+		queue->capacity = queue->capacity ? queue->capacity * 2 : 16;
+		queue->uploads = realloc(queue->uploads, queue->capacity * sizeof(RendererUpload));
+		assert(queue->uploads);
+	}
+
+	surface->refcount++;
+
+	queue->uploads[queue->count++] = (RendererUpload) {
+		.view = retain(view),
+		.surface = surface,
+		.bytes = bytes,
+		.area = area,
+		.isRequested = true
+	};
+
+	$(view, setNeedsDisplay);
+	return 0;
+}
+
+/**
+ * @fn _Bool Renderer::requestTextureRegion(Renderer *self, View *view, SDL_Surface *surface, RendererTexture *texture)
+ * @memberof Renderer
+ */
+static _Bool requestTextureRegion(Renderer *self, View *view, SDL_Surface *surface, RendererTexture *texture) {
+
+	assert(surface);
+	assert(texture);
+
+	if (surface->format->BytesPerPixel != 4 ||
+		surface->w > DEFAULT_RENDERER_ATLAS_IMAGE_SIZE ||
+		surface->h > DEFAULT_RENDERER_ATLAS_IMAGE_SIZE) {
+
+		*texture = (RendererTexture) {
+			.texture = $(self, requestTexture, view, surface),
+			.texcoords = { 0.0, 0.0, 1.0, 1.0 }
+		};
+
+		return texture->texture != 0;
+	}
+
+	struct RendererAtlas *atlas = self->atlas;
+
+	const RendererAtlasEntry *entry = atlasEntry(atlas, surface);
+
+	if (entry == NULL) {
+
+		const size_t bytes = surface->pitch * surface->h;
+		if (withinUploadBudget(self, bytes) == false) {
+			*texture = (RendererTexture) { .texture = 0 };
+			$(view, setNeedsDisplay);
+			return false;
+		}
+
+		if (atlas->count == atlas->capacity) {
+			atlas->capacity = atlas->capacity ? atlas->capacity * 2 : 64;
+			atlas->entries = realloc(atlas->entries, atlas->capacity * sizeof(RendererAtlasEntry));
+			assert(atlas->entries);
+		}
+
+		RendererAtlasEntry *newEntry = &atlas->entries[atlas->count];
+
+		newEntry->page = packAtlas(atlas, surface->w, surface->h, &newEntry->rect);
+		newEntry->surface = surface;
+		surface->refcount++;
+
+		int *bucket = atlasBucket(atlas, surface);
+
+		newEntry->bucketNext = *bucket;
+		*bucket = (int) atlas->count++;
+
+		glBindTexture(GL_TEXTURE_2D, newEntry->page->texture);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, surface->pitch / 4);
+
+		glTexSubImage2D(GL_TEXTURE_2D, 0, newEntry->rect.x, newEntry->rect.y, newEntry->rect.w, newEntry->rect.h,
+						GL_RGBA, GL_UNSIGNED_BYTE, surface->pixels);
+
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+
+		self->uploads->statistics.uploaded++;
+		self->uploads->statistics.uploadedBytes += bytes;
+
+		entry = newEntry;
 	}
 
-	const SDL_Rect scissor = MVC_TransformToWindow(window, &rect);
+	*texture = (RendererTexture) {
+		.texture = entry->page->texture,
+		.texcoords = {
+			(entry->rect.x + 0.5f) / (GLfloat) DEFAULT_RENDERER_ATLAS_SIZE,
+			(entry->rect.y + 0.5f) / (GLfloat) DEFAULT_RENDERER_ATLAS_SIZE,
+			(entry->rect.x + entry->rect.w - 0.5f) / (GLfloat) DEFAULT_RENDERER_ATLAS_SIZE,
+			(entry->rect.y + entry->rect.h - 0.5f) / (GLfloat) DEFAULT_RENDERER_ATLAS_SIZE
+		},
+		.isShared = true
+	};
+
+	return true;
+}
+
+/**
+ * @fn void Renderer::setClippingFrame(Renderer *self, const SDL_Rect *clippingFrame)
+ * @memberof Renderer
+ */
+static void setClippingFrame(Renderer *self, const SDL_Rect *clippingFrame) {
 
-	glScissor(scissor.x - 1, scissor.y - 1, scissor.w + 1, scissor.h + 1);
+	if (self->batchesDrawCalls) {
+		self->batch->clips = clippingFrame != NULL;
+		if (clippingFrame) {
+			self->batch->clip = MakeRect(clippingFrame->x - 1,
+										 clippingFrame->y,
+										 clippingFrame->w + 1,
+										 clippingFrame->h + 1);
+		}
+	} else {
+		setScissor(self, clippingFrame);
+	}
 }
 
 /**
@@ -324,9 +1968,33 @@ static void setClippingFrame(Renderer *self, const SDL_Rect *clippingFrame) {
  * @memberof Renderer
  */
 static void setDrawColor(Renderer *self, const SDL_Color *color) {
+
+	assert(color);
+
+	self->batch->color = *color;
+
 	glColor4ubv((const GLubyte *) color);
 }
 
+/**
+ * @fn RendererUploadStatistics Renderer::uploadStatistics(const Renderer *self)
+ * @memberof Renderer
+ */
+static RendererUploadStatistics uploadStatistics(const Renderer *self) {
+
+	RendererUploadStatistics statistics = self->uploads->statistics;
+
+	for (size_t i = 0; i < self->uploads->count; i++) {
+		const RendererUpload *upload = &self->uploads->uploads[i];
+		if (upload->texture == 0) {
+			statistics.queued++;
+			statistics.queuedBytes += upload->bytes;
+		}
+	}
+
+	return statistics;
+}
+
 #pragma mark - Class lifecycle
 
 /**
@@ -344,12 +2012,19 @@ static void initialize(Class *clazz) {
 	((RendererInterface *) clazz->def->interface)->drawRect = drawRect;
 	((RendererInterface *) clazz->def->interface)->drawRectFilled = drawRectFilled;
 	((RendererInterface *) clazz->def->interface)->drawTexture = drawTexture;
+	((RendererInterface *) clazz->def->interface)->drawTextureRegion = drawTextureRegion;
+	((RendererInterface *) clazz->def->interface)->drawTextureRegions = drawTextureRegions;
 	((RendererInterface *) clazz->def->interface)->endFrame = endFrame;
+	((RendererInterface *) clazz->def->interface)->flush = flush;
 	((RendererInterface *) clazz->def->interface)->init = init;
+	((RendererInterface *) clazz->def->interface)->isCompositeValid = isCompositeValid;
 	((RendererInterface *) clazz->def->interface)->render = render;
 	((RendererInterface *) clazz->def->interface)->renderDeviceDidReset = renderDeviceDidReset;
+	((RendererInterface *) clazz->def->interface)->requestTexture = requestTexture;
+	((RendererInterface *) clazz->def->interface)->requestTextureRegion = requestTextureRegion;
 	((RendererInterface *) clazz->def->interface)->setClippingFrame = setClippingFrame;
 	((RendererInterface *) clazz->def->interface)->setDrawColor = setDrawColor;
+	((RendererInterface *) clazz->def->interface)->uploadStatistics = uploadStatistics;
 }
 
 /**
@@ -37,6 +37,50 @@
  * requirements.
  */
 
+#define DEFAULT_RENDERER_BATCH_SIZE 0x1000
+#define DEFAULT_RENDERER_DAMAGE_RECTS 16
+#define DEFAULT_RENDERER_UPLOAD_BUDGET 0x400000
+#define DEFAULT_RENDERER_ATLAS_SIZE 1024
+#define DEFAULT_RENDERER_ATLAS_IMAGE_SIZE 128
+#define DEFAULT_RENDERER_ATLAS_BUCKETS 256
+
+/**
+ * @brief A texture, or a region of a shared atlas texture, requested for a View.
+ */
+typedef struct {
+
+	/**
+	 * @brief The OpenGL texture name, or `0` if the texture is not yet resident.
+	 */
+	GLuint texture;
+
+	/**
+	 * @brief The normalized texture coordinates of the region, `{ s0, t0, s1, t1 }`.
+	 */
+	GLfloat texcoords[4];
+
+	/**
+	 * @brief True if the texture is a shared atlas page, which belongs to the Renderer.
+	 */
+	_Bool isShared;
+} RendererTexture;
+
+/**
+ * @brief Texture upload statistics for the current frame.
+ */
+typedef struct {
+
+	/**
+	 * @brief The count and size in bytes of textures uploaded this frame.
+	 */
+	size_t uploaded, uploadedBytes;
+
+	/**
+	 * @brief The count and size in bytes of textures awaiting upload.
+	 */
+	size_t queued, queuedBytes;
+} RendererUploadStatistics;
+
 typedef struct Renderer Renderer;
 typedef struct RendererInterface RendererInterface;
 
@@ -61,9 +105,69 @@ struct Renderer {
 	RendererInterface *interface;
 
 	/**
-	 * @brief The Views to be drawn each frame.
+	 * @brief The vertex batch.
+	 * @private
+	 */
+	struct RendererBatch *batch;
+
+	/**
+	 * @brief The shared atlas of small images.
+	 * @private
+	 */
+	struct RendererAtlas *atlas;
+
+	/**
+	 * @brief If `true`, draw operations are accumulated into a single vertex array, and submitted
+	 * in as few draw calls as possible.
+	 * @details The batch is flushed only when the texture or primitive type changes, when it is
+	 * full, or at the end of the frame. Clipping is performed on the CPU so that changes to the
+	 * clipping frame do not break the batch.
+	 * @remarks Views which issue OpenGL commands directly should call Renderer::flush first.
+	 */
+	_Bool batchesDrawCalls;
+
+	/**
+	 * @brief The offscreen composite bookkeeping.
+	 * @private
+	 */
+	struct RendererComposite *composite;
+
+	/**
+	 * @brief If `true`, Views are drawn into an offscreen framebuffer, which is then blended over
+	 * the window with a single textured quad.
+	 * @details Only the regions of the framebuffer occupied by Views which have changed, moved, or
+	 * been added or removed are redrawn. When nothing has changed, the WindowController skips
+	 * drawing Views altogether and simply composites the framebuffer.
+	 * @remarks This requires framebuffer object support. If it is unavailable, Views are drawn
+	 * directly, as if this property were `false`.
+	 */
+	_Bool compositesViews;
+
+	/**
+	 * @brief The draw list bookkeeping.
+	 * @private
+	 */
+	struct RendererDrawList *drawList;
+
+	/**
+	 * @brief The Views to be drawn, sorted by depth.
+	 * @remarks This list is retained across frames, and is only rebuilt when the set of visible
+	 * Views or their depths change.
 	 */
 	MutableArray *views;
+
+	/**
+	 * @brief The texture upload queue.
+	 * @private
+	 */
+	struct RendererUploadQueue *uploads;
+
+	/**
+	 * @brief The size in bytes of texture data which may be uploaded per frame through
+	 * Renderer::requestTexture, or `0` for no limit.
+	 * @remarks At least one queued texture is uploaded per frame, regardless of its size.
+	 */
+	size_t uploadBudget;
 };
 
 /**
@@ -77,20 +181,25 @@ struct RendererInterface {
 	ObjectInterface objectInterface;
 
 	/**
-	 * @fn void Renderer::addView(Renderer *self, View *view)
+	 * @fn void Renderer::addView(Renderer *self, View *view, int depth)
 	 * @brief Adds the View to the Renderer for the current frame.
+	 * @remarks Views must be added in hierarchy order, as View::draw does.
 	 * @param self The Renderer.
 	 * @param view The View.
+	 * @param depth The View's depth, as returned by View::depth. View::draw derives it from the
+	 * depth of the superview, so that the hierarchy is not walked for every View.
 	 * @memberof Renderer
 	 */
-	void (*addView)(Renderer *self, View *view);
+	void (*addView)(Renderer *self, View *view, int depth);
 
 	/**
 	 * @fn void Renderer::beginFrame(Renderer *self)
 	 * @brief Sets up OpenGL state.
 	 * @param self The Renderer.
 	 * @remarks This method is called by the WindowController to begin rendering. Override this
-	 * method for custom OpenGL state setup, if desired.
+	 * method for custom OpenGL state setup, if desired. Glyphs rasterized on Font's worker threads
+	 * since the previous frame, and textures queued by Renderer::requestTexture, are uploaded
+	 * here, and Images decoded asynchronously are delivered, so overrides should call super.
 	 * @memberof Renderer
 	 */
 	void (*beginFrame)(Renderer *self);
@@ -107,7 +216,7 @@ struct RendererInterface {
 
 	/**
 	 * @fn void Renderer::drawLine(const Renderer *self, const SDL_Point *points)
-	 * @brief Draws a line segment between two points using `GL_LINE_STRIP`.
+	 * @brief Draws a line segment between two points.
 	 * @param self The Renderer.
 	 * @param points The points.
 	 * @memberof Renderer
@@ -116,7 +225,7 @@ struct RendererInterface {
 
 	/**
 	 * @fn void Renderer::drawLines(const Renderer *self, const SDL_Point *points, size_t count)
-	 * @brief Draws line segments between adjacent points using `GL_LINE_STRIP`.
+	 * @brief Draws line segments between adjacent points.
 	 * @param self The Renderer.
 	 * @param points The points.
 	 * @param count The length of points.
@@ -126,7 +235,7 @@ struct RendererInterface {
 
 	/**
 	 * @fn void Renderer::drawRect(const Renderer *self, const SDL_Rect *rect)
-	 * @brief Draws a rectangle using `GL_LINE_LOOP`.
+	 * @brief Draws a rectangle outline.
 	 * @param self The Renderer.
 	 * @param rect The rectangle.
 	 * @memberof Renderer
@@ -135,7 +244,7 @@ struct RendererInterface {
 
 	/**
 	 * @fn void Renderer::drawRectFilled(const Renderer *self, const SDL_Rect *rect)
-	 * @brief Fills a rectangle using `glRecti`.
+	 * @brief Fills a rectangle.
 	 * @param self The Renderer.
 	 * @param rect The rectangle.
 	 * @memberof Renderer
@@ -144,7 +253,7 @@ struct RendererInterface {
 
 	/**
 	 * @fn void Renderer::drawTexture(const Renderer *self, GLuint texture, const SDL_Rect *dest)
-	 * @brief Draws textured `GL_QUAD` in the given rectangle.
+	 * @brief Draws a textured quad in the given rectangle.
 	 * @param self The Renderer.
 	 * @param texture The texture.
 	 * @param dest The destination in screen coordinates.
@@ -152,6 +261,32 @@ struct RendererInterface {
 	 */
 	void (*drawTexture)(const Renderer *self, GLuint texture, const SDL_Rect *dest);
 
+	/**
+	 * @fn void Renderer::drawTextureRegion(const Renderer *self, GLuint texture, const GLfloat *texcoords, const SDL_Rect *dest)
+	 * @brief Draws a region of the given texture in the given rectangle.
+	 * @param self The Renderer.
+	 * @param texture The texture.
+	 * @param texcoords The normalized texture coordinates of the region, `{ s0, t0, s1, t1 }`.
+	 * @param dest The destination in screen coordinates.
+	 * @remarks This is useful for drawing from texture atlases.
+	 * @memberof Renderer
+	 */
+	void (*drawTextureRegion)(const Renderer *self, GLuint texture, const GLfloat *texcoords, const SDL_Rect *dest);
+
+	/**
+	 * @fn void Renderer::drawTextureRegions(const Renderer *self, GLuint texture, const GLfloat *texcoords, const SDL_Rect *dest, size_t count)
+	 * @brief Draws several regions of the given texture.
+	 * @param self The Renderer.
+	 * @param texture The texture.
+	 * @param texcoords The normalized texture coordinates of each region, `{ s0, t0, s1, t1 }`.
+	 * @param dest The destination of each region in screen coordinates.
+	 * @param count The count of regions.
+	 * @remarks The texture is bound once, and the regions are submitted in a single array draw,
+	 * whether or not the Renderer `batchesDrawCalls`.
+	 * @memberof Renderer
+	 */
+	void (*drawTextureRegions)(const Renderer *self, GLuint texture, const GLfloat *texcoords, const SDL_Rect *dest, size_t count);
+
 	/**
 	 * @fn void Renderer::endFrame(const Renderer *self)
 	 * @brief Resets OpenGL state. Does *not* swap buffers.
@@ -162,6 +297,15 @@ struct RendererInterface {
 	 */
 	void (*endFrame)(Renderer *self);
 
+	/**
+	 * @fn void Renderer::flush(const Renderer *self)
+	 * @brief Submits all batched draw operations to OpenGL.
+	 * @param self The Renderer.
+	 * @remarks This is a no-op unless `batchesDrawCalls` is `true`.
+	 * @memberof Renderer
+	 */
+	void (*flush)(const Renderer *self);
+
 	/**
 	 * @protected
 	 * @fn Renderer *Renderer::init(Renderer *self)
@@ -172,10 +316,22 @@ struct RendererInterface {
 	 */
 	Renderer *(*init)(Renderer *self);
 
+	/**
+	 * @fn _Bool Renderer::isCompositeValid(const Renderer *self)
+	 * @param self The Renderer.
+	 * @return True if the offscreen framebuffer holds a complete rendering of the View hierarchy,
+	 * and may be composited without drawing any Views.
+	 * @see Renderer::compositesViews
+	 * @memberof Renderer
+	 */
+	_Bool (*isCompositeValid)(const Renderer *self);
+
 	/**
 	 * @fn void Renderer::render(Renderer *self)
 	 * @brief Renders all Views added for the current frame, sorted by depth.
 	 * @param self The Renderer.
+	 * @remarks When compositing, only the damaged regions of the offscreen framebuffer are
+	 * rendered. The framebuffer is blended over the window by Renderer::endFrame.
 	 * @memberof Renderer
 	 */
 	void (*render)(Renderer *self);
@@ -188,6 +344,40 @@ struct RendererInterface {
 	 */
 	void (*renderDeviceDidReset)(Renderer *self);
 
+	/**
+	 * @fn GLuint Renderer::requestTexture(Renderer *self, View *view, SDL_Surface *surface)
+	 * @brief Requests a texture of the given surface for the given View, subject to the upload
+	 * budget.
+	 * @param self The Renderer.
+	 * @param view The View which will draw the texture.
+	 * @param surface The surface.
+	 * @return The OpenGL texture name, or `0` if the texture is not yet resident.
+	 * @remarks Once returned, the texture belongs to the View. If the texture is not yet resident,
+	 * the View is marked as needing display, and should draw a placeholder and request the texture
+	 * again when it is next rendered. Queued textures are uploaded in Renderer::beginFrame, largest
+	 * on screen first. Requests which are not repeated within a frame are discarded.
+	 * @see Renderer::uploadBudget
+	 * @memberof Renderer
+	 */
+	GLuint (*requestTexture)(Renderer *self, View *view, SDL_Surface *surface);
+
+	/**
+	 * @fn _Bool Renderer::requestTextureRegion(Renderer *self, View *view, SDL_Surface *surface, RendererTexture *texture)
+	 * @brief Requests a texture of the given surface for the given View, packing small surfaces
+	 * into a shared atlas.
+	 * @param self The Renderer.
+	 * @param view The View which will draw the texture.
+	 * @param surface The surface.
+	 * @param texture The texture to return.
+	 * @return True if the texture is resident, false otherwise.
+	 * @remarks Surfaces of up to `DEFAULT_RENDERER_ATLAS_IMAGE_SIZE` pixels square are packed into
+	 * shared atlas pages, so that Views which draw them may be batched together. Atlas pages are
+	 * evicted once all of the surfaces packed into them have been freed. Larger surfaces are
+	 * requested through Renderer::requestTexture, and belong to the View.
+	 * @memberof Renderer
+	 */
+	_Bool (*requestTextureRegion)(Renderer *self, View *view, SDL_Surface *surface, RendererTexture *texture);
+
 	/**
 	 * @fn void Renderer::setClippingFrame(Renderer *self, const SDL_Rect *clippingFrame)
 	 * @brief Sets the clipping frame for draw operations.
@@ -206,6 +396,14 @@ struct RendererInterface {
 	 * @memberof Renderer
 	 */
 	void (*setDrawColor)(Renderer *self, const SDL_Color *color);
+
+	/**
+	 * @fn RendererUploadStatistics Renderer::uploadStatistics(const Renderer *self)
+	 * @param self The Renderer.
+	 * @return The texture upload statistics for the current frame.
+	 * @memberof Renderer
+	 */
+	RendererUploadStatistics (*uploadStatistics)(const Renderer *self);
 };
 
 /**
@@ -27,8 +27,80 @@
 
 #define _Class _ScrollView
 
+/**
+ * @brief Clamps the given offset to the content View's size.
+ * @return The clamped offset.
+ */
+static SDL_Point clampOffset(const ScrollView *self, const SDL_Point *offset) {
+
+	SDL_Point clamped = MakePoint(0, 0);
+
+	if (self->contentView) {
+		const SDL_Size contentSize = $(self->contentView, size);
+		const SDL_Rect bounds = $((View *) self, bounds);
+
+		if (contentSize.w > bounds.w) {
+			clamped.x = clamp(offset->x, -(contentSize.w - bounds.w), 0);
+		}
+
+		if (contentSize.h > bounds.h) {
+			clamped.y = clamp(offset->y, -(contentSize.h - bounds.h), 0);
+		}
+	}
+
+	return clamped;
+}
+
+/**
+ * @brief Translates the content View to the current offset.
+ * @remarks Only the content View's origin changes, so the cached frames of the content View's
+ * subtree are invalidated, but no layout is performed.
+ */
+static void translateContentView(ScrollView *self) {
+
+	View *contentView = self->contentView;
+	if (contentView) {
+		if (contentView->frame.x != self->contentOffset.x || contentView->frame.y != self->contentOffset.y) {
+
+			contentView->frame.x = self->contentOffset.x;
+			contentView->frame.y = self->contentOffset.y;
+
+			$(contentView, invalidateFrames);
+
+			$((View *) self, setNeedsDisplay);
+		}
+	}
+}
+
 #pragma mark - View
 
+/**
+ * @see View::layoutIfNeeded(View *)
+ * @remarks The content View is resized only when its layout has changed, not when scrolling.
+ */
+static void layoutIfNeeded(View *self) {
+
+	ScrollView *this = (ScrollView *) self;
+
+	const View *contentView = this->contentView;
+	const _Bool contentNeedsLayout = contentView && (contentView->needsLayout || contentView->descendantsNeedLayout);
+
+	super(View, self, layoutIfNeeded);
+
+	if (contentNeedsLayout && this->contentView) {
+
+		$(this->contentView, sizeToContain);
+
+		this->contentOffset = clampOffset(this, &this->contentOffset);
+
+		translateContentView(this);
+
+		if (this->contentView->needsLayout) {
+			$(this->contentView, layoutIfNeeded);
+		}
+	}
+}
+
 /**
  * @see View::layoutSubviews(View *)
  */
@@ -39,10 +111,11 @@ static void layoutSubviews(View *self) {
 	ScrollView *this = (ScrollView *) self;
 
 	if (this->contentView) {
-		this->contentView->frame.x = this->contentOffset.x;
-		this->contentView->frame.y = this->contentOffset.y;
-
 		$(this->contentView, sizeToContain);
+
+		this->contentOffset = clampOffset(this, &this->contentOffset);
+
+		translateContentView(this);
 	}
 }
 
@@ -88,6 +161,13 @@ static _Bool captureEvent(Control *self, const SDL_Event *event) {
 	return super(Control, self, captureEvent, event);
 }
 
+/**
+ * @see Control::captureEventMask(const Control *)
+ */
+static int captureEventMask(const Control *self) {
+	return ViewEventMaskMouse;
+}
+
 #pragma mark - ScrollView
 
 /**
@@ -117,27 +197,13 @@ static ScrollView *initWithFrame(ScrollView *self, const SDL_Rect *frame, Contro
  */
 static void scrollToOffset(ScrollView *self, const SDL_Point *offset) {
 
-	if (self->contentView) {
-		const SDL_Size contentSize = $(self->contentView, size);
-		const SDL_Rect bounds = $((View *) self, bounds);
+	self->contentOffset = clampOffset(self, offset);
 
-		if (contentSize.w > bounds.w) {
-			self->contentOffset.x = clamp(offset->x, -(contentSize.w - bounds.w), 0);
-		} else {
-			self->contentOffset.x = 0;
-		}
+	translateContentView(self);
 
-		if (contentSize.h > bounds.h) {
-			self->contentOffset.y = clamp(offset->y, -(contentSize.h - bounds.h), 0);
-		} else {
-			self->contentOffset.y = 0;
-		}
-
-	} else {
-		self->contentOffset.x = self->contentOffset.y = 0;
+	if (self->delegate.didScroll) {
+		self->delegate.didScroll(self);
 	}
-
-	self->control.view.needsLayout = true;
 }
 
 /**
@@ -167,9 +233,11 @@ static void setContentView(ScrollView *self, View *contentView) {
  */
 static void initialize(Class *clazz) {
 
+	((ViewInterface *) clazz->def->interface)->layoutIfNeeded = layoutIfNeeded;
 	((ViewInterface *) clazz->def->interface)->layoutSubviews = layoutSubviews;
 
 	((ControlInterface *) clazz->def->interface)->captureEvent = captureEvent;
+	((ControlInterface *) clazz->def->interface)->captureEventMask = captureEventMask;
 
 	((ScrollViewInterface *) clazz->def->interface)->initWithFrame = initWithFrame;
 	((ScrollViewInterface *) clazz->def->interface)->scrollToOffset = scrollToOffset;
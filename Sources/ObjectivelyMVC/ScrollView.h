@@ -81,6 +81,11 @@ struct ScrollView {
 	 * @brief The content View.
 	 */
 	View *contentView;
+
+	/**
+	 * @brief The delegate.
+	 */
+	ScrollViewDelegate delegate;
 };
 
 /**
@@ -109,6 +114,8 @@ struct ScrollViewInterface {
 	 * @brief Scrolls the content View to the specified offset.
 	 * @param self The ScrollView.
 	 * @param offset The offset.
+	 * @remarks Scrolling translates the content View without laying it out, so its cost does not
+	 * depend on the size of the content.
 	 * @memberof ScrollView
 	 */
 	void (*scrollToOffset)(ScrollView *self, const SDL_Point *offset);
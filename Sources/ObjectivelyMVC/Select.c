@@ -174,13 +174,20 @@ static _Bool captureEvent(Control *self, const SDL_Event *event) {
 	return super(Control, self, captureEvent, event);
 }
 
+/**
+ * @see Control::captureEventMask(const Control *)
+ */
+static int captureEventMask(const Control *self) {
+	return ViewEventMaskMouse;
+}
+
 /**
  * @fn void Control::stateDidChange(Control *self)
  * @memberof Control
  */
 static void stateDidChange(Control *self) {
 
-	((View *) self)->needsLayout = true;
+	$((View *) self, setNeedsLayout);
 
 	if (self->state & ControlStateHighlighted) {
 		self->view.zIndex = 4;
@@ -230,7 +237,7 @@ static void addOption(Select *self, const char *title, ident value) {
 		self->selectedOption = option;
 	}
 
-	self->control.view.needsLayout = true;
+	$((View *) self, setNeedsLayout);
 
 	release(option);
 }
@@ -307,7 +314,7 @@ static void removeAllOptions(Select *self) {
 
 	self->selectedOption = NULL;
 
-	self->control.view.needsLayout = true;
+	$((View *) self, setNeedsLayout);
 }
 
 /**
@@ -324,7 +331,7 @@ static void removeOption(Select *self, Option *option) {
 
 	$((View *) option, removeFromSuperview);
 
-	self->control.view.needsLayout = true;
+	$((View *) self, setNeedsLayout);
 }
 
 /**
@@ -361,6 +368,7 @@ static void initialize(Class *clazz) {
 	((ViewInterface *) clazz->def->interface)->sizeThatFits = sizeThatFits;
 
 	((ControlInterface *) clazz->def->interface)->captureEvent = captureEvent;
+	((ControlInterface *) clazz->def->interface)->captureEventMask = captureEventMask;
 	((ControlInterface *) clazz->def->interface)->stateDidChange = stateDidChange;
 
 	((SelectInterface *) clazz->def->interface)->addOption = addOption;
@@ -177,6 +177,13 @@ static _Bool captureEvent(Control *self, const SDL_Event *event) {
 	return super(Control, self, captureEvent, event);
 }
 
+/**
+ * @see Control::captureEventMask(const Control *)
+ */
+static int captureEventMask(const Control *self) {
+	return ViewEventMaskMouse;
+}
+
 #pragma mark - Slider
 
 /**
@@ -237,7 +244,7 @@ static void setValue(Slider *self, double value) {
 	const double delta = fabs(self->value - value);
 	if (delta > __DBL_EPSILON__) {
 		self->value = value;
-		self->control.view.needsLayout = true;
+		$((View *) self, setNeedsLayout);
 
 		char text[64];
 		snprintf(text, sizeof(text), self->labelFormat, self->value);
@@ -265,6 +272,7 @@ static void initialize(Class *clazz) {
 	((ViewInterface *) clazz->def->interface)->render = render;
 
 	((ControlInterface *) clazz->def->interface)->captureEvent = captureEvent;
+	((ControlInterface *) clazz->def->interface)->captureEventMask = captureEventMask;
 
 	((SliderInterface *) clazz->def->interface)->initWithFrame = initWithFrame;
 	((SliderInterface *) clazz->def->interface)->setValue = setValue;
@@ -29,6 +29,13 @@
 
 #include <ObjectivelyMVC/TableColumn.h>
 
+const EnumName TableColumnValueTypeNames[] = MakeEnumNames(
+	MakeEnumName(TableColumnValueTypeObject),
+	MakeEnumName(TableColumnValueTypeInteger),
+	MakeEnumName(TableColumnValueTypeDouble),
+	MakeEnumName(TableColumnValueTypeString)
+);
+
 #define _Class _TableColumn
 
 #pragma mark - Object
@@ -42,6 +49,8 @@ static void dealloc(Object *self) {
 
 	free(this->identifier);
 
+	release(this->reusableCells);
+
 	super(Object, self, dealloc);
 }
 
@@ -64,6 +73,9 @@ static TableColumn *initWithIdentifier(TableColumn *self, const char *identifier
 
 		$(self->headerCell->tableCellView.text, setText, self->identifier);
 
+		self->reusableCells = $$(MutableArray, array);
+		assert(self->reusableCells);
+
 		self->width = DEFAULT_TABLE_COLUMN_WIDTH;
 	}
 
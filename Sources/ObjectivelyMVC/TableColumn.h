@@ -23,7 +23,7 @@
 
 #pragma once
 
-#include <Objectively/Object.h>
+#include <Objectively/MutableArray.h>
 
 #include <ObjectivelyMVC/TableHeaderCellView.h>
 
@@ -34,6 +34,18 @@
 
 #define DEFAULT_TABLE_COLUMN_WIDTH 100
 
+/**
+ * @brief The types of the values of a TableColumn, which select its sort strategy.
+ */
+typedef enum {
+	TableColumnValueTypeObject,
+	TableColumnValueTypeInteger,
+	TableColumnValueTypeDouble,
+	TableColumnValueTypeString
+} TableColumnValueType;
+
+OBJECTIVELYMVC_EXPORT const EnumName TableColumnValueTypeNames[];
+
 typedef struct TableColumn TableColumn;
 typedef struct TableColumnInterface TableColumnInterface;
 
@@ -90,6 +102,22 @@ struct TableColumn {
 	 */
 	Order order;
 
+	/**
+	 * @brief Cells recycled by the TableView, available for reuse.
+	 * @see TableView::dequeueReusableCell(const TableView *, const TableColumn *)
+	 * @private
+	 */
+	MutableArray *reusableCells;
+
+	/**
+	 * @brief The type of the values of this column.
+	 * @details Values of type TableColumnValueTypeInteger are `intptr_t`, and are sorted with a
+	 * radix sort, as are those of TableColumnValueTypeDouble, which are Numbers. Values of
+	 * TableColumnValueTypeString are Strings, and are sorted by their characters. Otherwise, the
+	 * comparator is used.
+	 */
+	TableColumnValueType valueType;
+
 	/**
 	 * @brief The width.
 	 */
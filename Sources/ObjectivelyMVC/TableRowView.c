@@ -174,6 +174,8 @@ static void setSelected(TableRowView *self, _Bool selected) {
 	} else {
 		self->stackView.view.backgroundColor = self->assignedBackgroundColor;
 	}
+
+	$((View *) self, setNeedsDisplay);
 }
 
 #pragma mark - Class lifecycle
@@ -22,7 +22,10 @@
  */
 
 #include <assert.h>
+#include <stdlib.h>
+#include <string.h>
 
+#include <Objectively/Number.h>
 #include <Objectively/String.h>
 
 #include <ObjectivelyMVC/TableView.h>
@@ -41,8 +44,13 @@ static void dealloc(Object *self) {
 	release(this->columns);
 	release(this->contentView);
 	release(this->headerView);
+	release(this->leadingSpacer);
 	release(this->rows);
 	release(this->scrollView);
+	release(this->trailingSpacer);
+
+	free(this->rowOrder);
+	free(this->rowSelection);
 
 	super(Object, self, dealloc);
 }
@@ -64,6 +72,7 @@ static void awakeWithDictionary_columns(const Array *array, ident obj, ident dat
 		MakeInlet("cellAlignment", InletTypeEnum, &column->cellAlignment, (ident) ViewAlignmentNames),
 		MakeInlet("maxWidth", InletTypeInteger, &column->maxWidth, NULL),
 		MakeInlet("minWidth", InletTypeInteger, &column->minWidth, NULL),
+		MakeInlet("valueType", InletTypeEnum, &column->valueType, (ident) TableColumnValueTypeNames),
 		MakeInlet("width", InletTypeInteger, &column->width, NULL)
 	);
 
@@ -86,7 +95,8 @@ static void awakeWithDictionary(View *self, const Dictionary *dictionary) {
 		MakeInlet("alternateBackgroundColor", InletTypeColor, &this->alternateBackgroundColor, NULL),
 		MakeInlet("cellSpacing", InletTypeInteger, &this->cellSpacing, NULL),
 		MakeInlet("rowHeight", InletTypeInteger, &this->rowHeight, NULL),
-		MakeInlet("usesAlternateBackgroundColor", InletTypeBool, &this->usesAlternateBackgroundColor, NULL)
+		MakeInlet("usesAlternateBackgroundColor", InletTypeBool, &this->usesAlternateBackgroundColor, NULL),
+		MakeInlet("virtualizesRows", InletTypeBool, &this->virtualizesRows, NULL)
 	);
 
 	$(self, bind, dictionary, inlets);
@@ -104,6 +114,147 @@ static View *init(View *self) {
 	return (View *) $((TableView *) self, initWithFrame, NULL, ControlStyleDefault);
 }
 
+/**
+ * @brief Applies the row height, background color and selection state of the row at the given index.
+ */
+static void layoutRow(const TableView *self, TableRowView *row, size_t index) {
+
+	row->stackView.view.frame.h = self->rowHeight;
+
+	if (self->usesAlternateBackgroundColor && (index & 1)) {
+		row->assignedBackgroundColor = self->alternateBackgroundColor;
+	} else {
+		row->assignedBackgroundColor = Colors.Clear;
+	}
+
+	$(row, setSelected, self->rowSelection[index]);
+}
+
+/**
+ * @brief Creates the row at the given index, populating it with cells from the delegate.
+ */
+static TableRowView *createRow(TableView *self, size_t index) {
+
+	TableRowView *row = $(alloc(TableRowView), initWithTableView, self);
+	assert(row);
+
+	const Array *columns = (Array *) self->columns;
+	for (size_t i = 0; i < columns->count; i++) {
+
+		const TableColumn *column = $(columns, objectAtIndex, i);
+
+		TableCellView *cell = self->delegate.cellForColumnAndRow(self, column, self->rowOrder[index]);
+		assert(cell);
+
+		$(row, addCell, cell);
+		release(cell);
+	}
+
+	layoutRow(self, row, index);
+
+	return row;
+}
+
+/**
+ * @brief Removes the given row, making its cells available to TableView::dequeueReusableCell.
+ * @remarks The reuse queue of each column is bounded by the number of materialized rows.
+ */
+static void recycleRow(TableView *self, TableRowView *row) {
+
+	const Array *columns = (Array *) self->columns;
+	const Array *cells = (Array *) row->cells;
+
+	for (size_t i = 0; i < cells->count && i < columns->count; i++) {
+
+		const TableColumn *column = $(columns, objectAtIndex, i);
+		if (column->reusableCells->array.count < self->rows->array.count) {
+
+			TableCellView *cell = $(cells, objectAtIndex, i);
+			$(column->reusableCells, addObject, cell);
+		}
+	}
+
+	$(row, removeAllCells);
+
+	$((View *) self->contentView, removeSubview, (View *) row);
+}
+
+/**
+ * @brief Materializes the rows intersecting the visible area, and recycles those which do not.
+ * @remarks Unless `virtualizesRows` is set, all rows are materialized. The rows above and below
+ * the materialized rows are represented by spacers, so that the content View is sized to contain
+ * every row, and row indexes continue to map directly to offsets within it.
+ */
+static void layoutVisibleRows(TableView *self) {
+
+	size_t first = 0, last = self->numberOfRows;
+
+	if (self->virtualizesRows && self->rowHeight) {
+
+		const SDL_Rect bounds = $((View *) self->scrollView, bounds);
+		const int top = max(-self->scrollView->contentOffset.y, 0);
+
+		first = min((size_t) (top / self->rowHeight), self->numberOfRows);
+		last = min((size_t) ((top + bounds.h + self->rowHeight - 1) / self->rowHeight), self->numberOfRows);
+	}
+
+	View *contentView = (View *) self->contentView;
+
+	const Array *rows = (Array *) self->rows;
+	if (first != self->firstVisibleRow || last - first != rows->count) {
+
+		MutableArray *visibleRows = $$(MutableArray, arrayWithCapacity, last - first);
+		assert(visibleRows);
+
+		for (size_t i = 0; i < rows->count; i++) {
+
+			TableRowView *row = $(rows, objectAtIndex, i);
+
+			const size_t index = self->firstVisibleRow + i;
+			if (index < first || index >= last) {
+				recycleRow(self, row);
+			} else {
+				$(contentView, removeSubview, (View *) row);
+			}
+		}
+
+		$(contentView, removeSubview, self->trailingSpacer);
+
+		for (size_t i = first; i < last; i++) {
+
+			TableRowView *row;
+			if (i >= self->firstVisibleRow && i < self->firstVisibleRow + rows->count) {
+				row = $(rows, objectAtIndex, i - self->firstVisibleRow);
+				retain(row);
+			} else {
+				row = createRow(self, i);
+			}
+
+			$(visibleRows, addObject, row);
+			$(contentView, addSubview, (View *) row);
+
+			release(row);
+		}
+
+		$(contentView, addSubview, self->trailingSpacer);
+
+		release(self->rows);
+		self->rows = visibleRows;
+
+		self->firstVisibleRow = first;
+	}
+
+	const int leading = (int) first * self->rowHeight;
+	const int trailing = (int) (self->numberOfRows - last) * self->rowHeight;
+
+	if (self->leadingSpacer->frame.h != leading || self->trailingSpacer->frame.h != trailing) {
+		self->leadingSpacer->frame.h = leading;
+		self->trailingSpacer->frame.h = trailing;
+
+		$(contentView, setNeedsLayout);
+	}
+}
+
 /**
  * @see View::layoutSubviews(View *)
  */
@@ -114,21 +265,15 @@ static void layoutSubviews(View *self) {
 	View *scrollView = (View *) this->scrollView;
 
 	scrollView->frame = $(this, scrollableArea);
-	scrollView->needsLayout = true;
+	$(scrollView, setNeedsLayout);
+
+	layoutVisibleRows(this);
 
 	const Array *rows = (Array *) this->rows;
 	for (size_t i = 0; i < rows->count; i++) {
 
 		TableRowView *row = (TableRowView *) $(rows, objectAtIndex, i);
-		row->stackView.view.frame.h = this->rowHeight;
-
-		if (this->usesAlternateBackgroundColor && (i & 1)) {
-			row->assignedBackgroundColor = this->alternateBackgroundColor;
-		} else {
-			row->assignedBackgroundColor = Colors.Clear;
-		}
-
-		row->stackView.view.backgroundColor = row->assignedBackgroundColor;
+		layoutRow(this, row, this->firstVisibleRow + i);
 	}
 
 	super(View, self, layoutSubviews);
@@ -183,24 +328,22 @@ static _Bool captureEvent(Control *self, const SDL_Event *event) {
 				};
 
 				const ssize_t index = $(this, rowAtPoint, &point);
+				if (index > -1 && (size_t) index < this->numberOfRows) {
 
-				const Array *rows = (Array *) this->rows;
-				if (index > -1 && index < rows->count) {
-
-					TableRowView *row = $(rows, objectAtIndex, index);
+					const _Bool isSelected = this->rowSelection[index];
 
 					switch (this->control.selection) {
 						case ControlSelectionNone:
 							break;
 						case ControlSelectionSingle:
-							if (row->isSelected == false) {
+							if (isSelected == false) {
 								$(this, deselectAll);
 								$(this, selectRowAtIndex, index);
 							}
 							break;
 						case ControlSelectionMultiple:
 							if (SDL_GetModState() & (KMOD_CTRL | KMOD_GUI)) {
-								if (row->isSelected) {
+								if (isSelected) {
 									$(this, deselectRowAtIndex, index);
 								} else {
 									$(this, selectRowAtIndex, index);
@@ -229,6 +372,13 @@ static _Bool captureEvent(Control *self, const SDL_Event *event) {
 	return super(Control, self, captureEvent, event);
 }
 
+/**
+ * @see Control::captureEventMask(const Control *)
+ */
+static int captureEventMask(const Control *self) {
+	return ViewEventMaskMouse;
+}
+
 
 #pragma mark - TableView
 
@@ -290,6 +440,19 @@ static TableColumn *columnWithIdentifier(const TableView *self, const char *iden
 	return NULL;
 }
 
+/**
+ * @brief Returns the materialized row at the given index, or `NULL` if it is not materialized.
+ */
+static TableRowView *visibleRowAtIndex(const TableView *self, size_t index) {
+
+	const Array *rows = (Array *) self->rows;
+	if (index >= self->firstVisibleRow && index < self->firstVisibleRow + rows->count) {
+		return $(rows, objectAtIndex, index - self->firstVisibleRow);
+	}
+
+	return NULL;
+}
+
 /**
  * @brief ArrayEnumerator for all Row deselection.
  */
@@ -302,6 +465,11 @@ static void deselectAll_enumerate(const Array *array, ident obj, ident data) {
  * @memberof TableView
  */
 static void deselectAll(TableView *self) {
+
+	if (self->numberOfRows) {
+		memset(self->rowSelection, 0, self->numberOfRows * sizeof(_Bool));
+	}
+
 	$((Array *) self->rows, enumerateObjects, deselectAll_enumerate, NULL);
 }
 
@@ -311,11 +479,13 @@ static void deselectAll(TableView *self) {
  */
 static void deselectRowAtIndex(TableView *self, size_t index) {
 
-	const Array *rows = (Array *) self->rows;
-	if (index < rows->count) {
+	if (index < self->numberOfRows) {
+		self->rowSelection[index] = false;
 
-		TableRowView *row = $(rows, objectAtIndex, index);
-		$(row, setSelected, false);
+		TableRowView *row = visibleRowAtIndex(self, index);
+		if (row) {
+			$(row, setSelected, false);
+		}
 	}
 }
 
@@ -332,6 +502,39 @@ static void deselectRowsAtIndexes(TableView *self, const IndexSet *indexes) {
 	}
 }
 
+/**
+ * @fn TableCellView *TableView::dequeueReusableCell(const TableView *self, const TableColumn *column)
+ * @memberof TableView
+ */
+static TableCellView *dequeueReusableCell(const TableView *self, const TableColumn *column) {
+
+	assert(column);
+
+	const Array *reusableCells = (Array *) column->reusableCells;
+	if (reusableCells->count) {
+
+		TableCellView *cell = $(reusableCells, lastObject);
+		retain(cell);
+
+		$(column->reusableCells, removeLastObject);
+
+		return cell;
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief ScrollViewDelegate callback for materializing rows as they are scrolled into view.
+ */
+static void didScroll(ScrollView *scrollView) {
+
+	TableView *this = scrollView->delegate.self;
+	if (this->virtualizesRows) {
+		layoutVisibleRows(this);
+	}
+}
+
 /**
  * @fn TableView *TableView::initWithFrame(TableView *self, const SDL_Rect *frame, ControlStyle style)
  * @memberof TableView
@@ -356,11 +559,23 @@ static TableView *initWithFrame(TableView *self, const SDL_Rect *frame, ControlS
 
 		self->contentView->view.autoresizingMask |= ViewAutoresizingWidth;
 
+		self->leadingSpacer = $(alloc(View), initWithFrame, NULL);
+		assert(self->leadingSpacer);
+
+		self->trailingSpacer = $(alloc(View), initWithFrame, NULL);
+		assert(self->trailingSpacer);
+
+		$((View *) self->contentView, addSubview, self->leadingSpacer);
+		$((View *) self->contentView, addSubview, self->trailingSpacer);
+
 		self->scrollView = $(alloc(ScrollView), initWithFrame, NULL, style);
 		assert(self->scrollView);
 
 		self->scrollView->control.view.autoresizingMask |= ViewAutoresizingWidth;
 
+		self->scrollView->delegate.self = self;
+		self->scrollView->delegate.didScroll = didScroll;
+
 		$(self->scrollView, setContentView, (View *) self->contentView);
 
 		$((View *) self, addSubview, (View *) self->scrollView);
@@ -392,42 +607,201 @@ static void reloadData_removeRows(const Array *array, ident obj, ident data) {
 	$((View *) data, removeSubview, (View *) obj);
 }
 
-static __thread TableView *_sortTableView;
+/**
+ * @brief A data source row number and its sort key.
+ */
+typedef struct {
+	union {
+		ident object;
+		const char *chars;
+		uint64_t bits;
+	} key;
+	size_t row;
+} TableViewSortEntry;
+
+/**
+ * @brief Maps the given value to an unsigned key of equivalent order, for radix sorting.
+ */
+static uint64_t reloadData_sortBits(const TableColumn *column, const ident value) {
+
+	const uint64_t sign = 1ull << 63;
+
+	uint64_t bits = 0;
+	switch (column->valueType) {
+		case TableColumnValueTypeInteger:
+			bits = (uint64_t) (intptr_t) value ^ sign;
+			break;
+		case TableColumnValueTypeDouble:
+			if (value) {
+				memcpy(&bits, &((const Number *) value)->value, sizeof(bits));
+			}
+			bits = (bits & sign) ? ~bits : bits | sign;
+			break;
+		default:
+			break;
+	}
+
+	return column->order == OrderDescending ? ~bits : bits;
+}
 
 /**
- * @brief Comparator for sorting TableViewRows.
- * @remarks This function relies on thread-local-storage.
+ * @brief Stable LSD radix sort of the given entries by their bit keys.
  */
-static Order reloadData_sortRows(const ident a, const ident b) {
+static void reloadData_radixSort(TableViewSortEntry *entries, TableViewSortEntry *scratch, size_t count) {
+
+	TableViewSortEntry *src = entries, *dst = scratch;
 
-	const TableColumn *column = _sortTableView->sortColumn;
-	if (column->comparator) {
-		const Array *rows = (Array *) _sortTableView->rows;
+	for (int shift = 0; shift < 64; shift += 8) {
 
-		const size_t row1 = $(rows, indexOfObject, a);
-		const size_t row2 = $(rows, indexOfObject, b);
+		size_t offsets[0x100];
+		memset(offsets, 0, sizeof(offsets));
 
-		const ident value1 = _sortTableView->dataSource.valueForColumnAndRow(_sortTableView, column, row1);
-		const ident value2 = _sortTableView->dataSource.valueForColumnAndRow(_sortTableView, column, row2);
+		for (size_t i = 0; i < count; i++) {
+			offsets[(src[i].key.bits >> shift) & 0xff]++;
+		}
+
+		if (offsets[(src[0].key.bits >> shift) & 0xff] == count) {
+			continue;
+		}
 
-		switch (column->order) {
-			case OrderAscending:
-				return column->comparator(value1, value2);
-			case OrderSame:
-				return OrderSame;
-			case OrderDescending:
-				return column->comparator(value2, value1);
+		for (size_t i = 0, offset = 0; i < lengthof(offsets); i++) {
+			const size_t n = offsets[i];
+			offsets[i] = offset;
+			offset += n;
 		}
+
+		for (size_t i = 0; i < count; i++) {
+			dst[offsets[(src[i].key.bits >> shift) & 0xff]++] = src[i];
+		}
+
+		TableViewSortEntry *swap = src;
+		src = dst;
+		dst = swap;
 	}
 
-	return OrderSame;
+	if (src != entries) {
+		memcpy(entries, src, count * sizeof(TableViewSortEntry));
+	}
 }
 
 /**
- * @brief ArrayEnumerator to add TableRowViews to the table's contentView.
+ * @brief Compares two entries by their object or string keys, in the column's sort order.
  */
-static void reloadData_addRows(const Array *array, ident obj, ident data) {
-	$((View *) data, addSubview, (View *) obj);
+static int reloadData_compare(const TableColumn *column, const TableViewSortEntry *a, const TableViewSortEntry *b) {
+
+	int order;
+	switch (column->valueType) {
+		case TableColumnValueTypeString:
+			order = strcmp(a->key.chars ?: "", b->key.chars ?: "");
+			break;
+		default:
+			order = column->comparator(a->key.object, b->key.object);
+			break;
+	}
+
+	return column->order == OrderDescending ? -order : order;
+}
+
+/**
+ * @brief Stable bottom-up merge sort of the given entries by their object or string keys.
+ */
+static void reloadData_mergeSort(const TableColumn *column, TableViewSortEntry *entries, TableViewSortEntry *scratch, size_t count) {
+
+	TableViewSortEntry *src = entries, *dst = scratch;
+
+	for (size_t width = 1; width < count; width *= 2) {
+		for (size_t lo = 0; lo < count; lo += width * 2) {
+
+			const size_t mid = min(lo + width, count);
+			const size_t hi = min(lo + width * 2, count);
+
+			size_t i = lo, j = mid, k = lo;
+			while (i < mid && j < hi) {
+				if (reloadData_compare(column, &src[j], &src[i]) < 0) {
+					dst[k++] = src[j++];
+				} else {
+					dst[k++] = src[i++];
+				}
+			}
+
+			while (i < mid) {
+				dst[k++] = src[i++];
+			}
+
+			while (j < hi) {
+				dst[k++] = src[j++];
+			}
+		}
+
+		TableViewSortEntry *swap = src;
+		src = dst;
+		dst = swap;
+	}
+
+	if (src != entries) {
+		memcpy(entries, src, count * sizeof(TableViewSortEntry));
+	}
+}
+
+/**
+ * @brief Sorts the row order by the sort column.
+ * @details The value of each row is fetched from the data source exactly once. Integer and
+ * double values are radix sorted, while all others are merge sorted.
+ */
+static void reloadData_sortRows(TableView *self) {
+
+	const TableColumn *column = self->sortColumn;
+
+	if (column == NULL || column->order == OrderSame) {
+		return;
+	}
+
+	if (column->valueType == TableColumnValueTypeObject && column->comparator == NULL) {
+		return;
+	}
+
+	assert(self->dataSource.valueForColumnAndRow);
+
+	const size_t count = self->numberOfRows;
+
+	TableViewSortEntry *entries = calloc(count * 2, sizeof(TableViewSortEntry));
+	assert(entries);
+
+	for (size_t i = 0; i < count; i++) {
+
+		const ident value = self->dataSource.valueForColumnAndRow(self, column, i);
+
+		switch (column->valueType) {
+			case TableColumnValueTypeObject:
+				entries[i].key.object = value;
+				break;
+			case TableColumnValueTypeInteger:
+			case TableColumnValueTypeDouble:
+				entries[i].key.bits = reloadData_sortBits(column, value);
+				break;
+			case TableColumnValueTypeString:
+				entries[i].key.chars = value ? ((String *) value)->chars : NULL;
+				break;
+		}
+
+		entries[i].row = i;
+	}
+
+	switch (column->valueType) {
+		case TableColumnValueTypeInteger:
+		case TableColumnValueTypeDouble:
+			reloadData_radixSort(entries, entries + count, count);
+			break;
+		default:
+			reloadData_mergeSort(column, entries, entries + count, count);
+			break;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		self->rowOrder[i] = entries[i].row;
+	}
+
+	free(entries);
 }
 
 /**
@@ -442,6 +816,8 @@ static void reloadData(TableView *self) {
 	$((Array *) self->rows, enumerateObjects, reloadData_removeRows, self->contentView);
 	$(self->rows, removeAllObjects);
 
+	self->firstVisibleRow = 0;
+
 	TableRowView *headerView = (TableRowView *) self->headerView;
 	$(headerView, removeAllCells);
 
@@ -452,41 +828,27 @@ static void reloadData(TableView *self) {
 		$(headerView, addCell, (TableCellView *) column->headerCell);
 	}
 
-	const size_t numberOfRows = self->dataSource.numberOfRows(self);
-	for (size_t i = 0; i < numberOfRows; i++) {
+	self->numberOfRows = self->dataSource.numberOfRows(self);
+	if (self->numberOfRows) {
 
-		TableRowView *row = $(alloc(TableRowView), initWithTableView, self);
-		assert(row);
+		self->rowOrder = realloc(self->rowOrder, self->numberOfRows * sizeof(size_t));
+		assert(self->rowOrder);
 
-		$(self->rows, addObject, row);
-		release(row);
+		self->rowSelection = realloc(self->rowSelection, self->numberOfRows * sizeof(_Bool));
+		assert(self->rowSelection);
 
-		for (size_t j = 0; j < columns->count; j++) {
-			const TableColumn *column = $(columns, objectAtIndex, j);
-
-			TableCellView *cell = self->delegate.cellForColumnAndRow(self, column, i);
-			assert(cell);
-
-			$(row, addCell, cell);
-			release(cell);
+		for (size_t i = 0; i < self->numberOfRows; i++) {
+			self->rowOrder[i] = i;
 		}
-	}
-
-	if (self->sortColumn) {
-		_sortTableView = self;
-
-		MutableArray *rows = (MutableArray *) $((Object *) self->rows, copy);
-		$(rows, sort, reloadData_sortRows);
 
-		release(self->rows);
-		self->rows = rows;
+		memset(self->rowSelection, 0, self->numberOfRows * sizeof(_Bool));
 
-		_sortTableView = NULL;
+		reloadData_sortRows(self);
 	}
 
-	$((Array *) self->rows, enumerateObjects, reloadData_addRows, self->contentView);
+	layoutVisibleRows(self);
 
-	self->control.view.needsLayout = true;
+	$((View *) self, setNeedsLayout);
 }
 
 /**
@@ -550,6 +912,11 @@ static void selectAll_enumerate(const Array *array, ident obj, ident data) {
  * @memberof TableView
  */
 static void selectAll(TableView *self) {
+
+	if (self->numberOfRows) {
+		memset(self->rowSelection, true, self->numberOfRows * sizeof(_Bool));
+	}
+
 	$((Array *) self->rows, enumerateObjects, selectAll_enumerate, NULL);
 }
 
@@ -559,19 +926,22 @@ static void selectAll(TableView *self) {
  */
 static IndexSet *selectedRowIndexes(const TableView *self) {
 
-	size_t indexes[self->rows->array.count];
-	size_t count = 0;
+	size_t *indexes = calloc(self->numberOfRows ?: 1, sizeof(size_t));
+	assert(indexes);
 
-	const Array *rows = (Array *) self->rows;
-	for (size_t i = 0; i < rows->count; i++) {
+	size_t count = 0;
 
-		const TableRowView *row = $(rows, objectAtIndex, i);
-		if (row->isSelected) {
+	for (size_t i = 0; i < self->numberOfRows; i++) {
+		if (self->rowSelection[i]) {
 			indexes[count++] = i;
 		}
 	}
 
-	return $(alloc(IndexSet), initWithIndexes, indexes, count);
+	IndexSet *selectedRowIndexes = $(alloc(IndexSet), initWithIndexes, indexes, count);
+
+	free(indexes);
+
+	return selectedRowIndexes;
 }
 
 /**
@@ -580,11 +950,13 @@ static IndexSet *selectedRowIndexes(const TableView *self) {
  */
 static void selectRowAtIndex(TableView *self, size_t index) {
 
-	const Array *rows = (Array *) self->rows;
-	if (index < rows->count) {
+	if (index < self->numberOfRows) {
+		self->rowSelection[index] = true;
 
-		TableRowView *row = $(rows, objectAtIndex, index);
-		$(row, setSelected, true);
+		TableRowView *row = visibleRowAtIndex(self, index);
+		if (row) {
+			$(row, setSelected, true);
+		}
 	}
 }
 
@@ -643,6 +1015,7 @@ static void initialize(Class *clazz) {
 	((ViewInterface *) clazz->def->interface)->sizeThatFits = sizeThatFits;
 
 	((ControlInterface *) clazz->def->interface)->captureEvent = captureEvent;
+	((ControlInterface *) clazz->def->interface)->captureEventMask = captureEventMask;
 
 	((TableViewInterface *) clazz->def->interface)->addColumn = addColumn;
 	((TableViewInterface *) clazz->def->interface)->columnAtPoint = columnAtPoint;
@@ -650,6 +1023,7 @@ static void initialize(Class *clazz) {
 	((TableViewInterface *) clazz->def->interface)->deselectAll = deselectAll;
 	((TableViewInterface *) clazz->def->interface)->deselectRowAtIndex = deselectRowAtIndex;
 	((TableViewInterface *) clazz->def->interface)->deselectRowsAtIndexes = deselectRowsAtIndexes;
+	((TableViewInterface *) clazz->def->interface)->dequeueReusableCell = dequeueReusableCell;
 	((TableViewInterface *) clazz->def->interface)->initWithFrame = initWithFrame;
 	((TableViewInterface *) clazz->def->interface)->reloadData = reloadData;
 	((TableViewInterface *) clazz->def->interface)->removeColumn = removeColumn;
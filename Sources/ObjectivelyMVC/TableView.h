@@ -86,6 +86,8 @@ struct TableViewDelegate {
 	 * @param column The TableColumn.
 	 * @param row The row number.
 	 * @return The cell for the given column and row number.
+	 * @remarks Implementations should first attempt to reuse a cell with
+	 * TableView::dequeueReusableCell, and create a new cell only if that returns `NULL`.
 	 */
 	TableCellView *(*cellForColumnAndRow)(const TableView *tableView, const TableColumn *column, size_t row);
 
@@ -150,13 +152,30 @@ struct TableView {
 	 */
 	TableViewDelegate delegate;
 
+	/**
+	 * @brief The index of the first materialized row.
+	 * @private
+	 */
+	size_t firstVisibleRow;
+
 	/**
 	 * @brief The header.
 	 */
 	TableHeaderView *headerView;
 
 	/**
-	 * @brief The rows.
+	 * @brief A spacer occupying the area of the rows above the materialized rows.
+	 * @private
+	 */
+	View *leadingSpacer;
+
+	/**
+	 * @brief The number of rows, as reported by the data source at the last reload.
+	 */
+	size_t numberOfRows;
+
+	/**
+	 * @brief The materialized rows, beginning with the row at `firstVisibleRow`.
 	 */
 	MutableArray *rows;
 
@@ -165,6 +184,18 @@ struct TableView {
 	 */
 	int rowHeight;
 
+	/**
+	 * @brief The data source row number of each row, in display order.
+	 * @private
+	 */
+	size_t *rowOrder;
+
+	/**
+	 * @brief The selection state of each row, in display order.
+	 * @private
+	 */
+	_Bool *rowSelection;
+
 	/**
 	 * @brief The scroll view.
 	 */
@@ -175,10 +206,24 @@ struct TableView {
 	 */
 	TableColumn *sortColumn;
 
+	/**
+	 * @brief A spacer occupying the area of the rows below the materialized rows.
+	 * @private
+	 */
+	View *trailingSpacer;
+
 	/**
 	 * @brief Set to `true` to enable alternate row coloring.
 	 */
 	_Bool usesAlternateBackgroundColor;
+
+	/**
+	 * @brief Set to `true` to materialize only those rows intersecting the visible area.
+	 * @details Rows scrolled out of view are discarded, and their cells are made available
+	 * to TableView::dequeueReusableCell. This allows very large data sources to be presented
+	 * at a constant cost, but requires that all rows have the same `rowHeight`.
+	 */
+	_Bool virtualizesRows;
 };
 
 /**
@@ -244,6 +289,18 @@ struct TableViewInterface {
 	 */
 	void (*deselectRowsAtIndexes)(TableView *self, const IndexSet *indexSet);
 
+	/**
+	 * @fn TableCellView *TableView::dequeueReusableCell(const TableView *self, const TableColumn *column)
+	 * @brief Dequeues a previously recycled cell for the given column.
+	 * @param self The TableView.
+	 * @param column The TableColumn.
+	 * @return A retained TableCellView, or `NULL` if none is available.
+	 * @remarks This method is intended to be called from TableViewDelegate::cellForColumnAndRow.
+	 * Dequeued cells retain their previous contents, and must be reconfigured for their new row.
+	 * @memberof TableView
+	 */
+	TableCellView *(*dequeueReusableCell)(const TableView *self, const TableColumn *column);
+
 	/**
 	 * @fn TableView *TableView::initWithFrame(TableView *self, const SDL_Rect *frame, ControlStyle style)
 	 * @brief Initializes this TableView with the specified frame and style.
@@ -279,6 +336,8 @@ struct TableViewInterface {
 	 * @param self The TableView.
 	 * @param point A point in window coordinate space.
 	 * @return The row index at the specified point, or `-1` if none.
+	 * @remarks Row indexes are in display order, and are independent of which rows are
+	 * materialized.
 	 * @memberof TableView
 	 */
 	ssize_t (*rowAtPoint)(const TableView *self, const SDL_Point *point);
@@ -40,8 +40,6 @@ static void dealloc(Object *self) {
 
 	free(this->text);
 
-	glDeleteTextures(1, &this->texture);
-
 	super(Object, self, dealloc);
 }
 
@@ -84,18 +82,16 @@ static void render(View *self, Renderer *renderer) {
 
 	if (this->text) {
 
-		if (this->texture == 0) {
-			SDL_Surface *surface = $(this->font, renderCharacters, this->text, this->color);
+		const SDL_Rect frame = $(self, renderFrame);
+		const SDL_Point origin = { frame.x, frame.y };
 
-			this->texture = $(renderer, createTexture, surface);
+		$(renderer, setDrawColor, &this->color);
 
-			SDL_FreeSurface(surface);
+		if ($(this->font, drawCharacters, this->text, renderer, &origin) == false) {
+			$(self, setNeedsDisplay);
 		}
 
-		assert(this->texture);
-
-		const SDL_Rect frame = $(self, renderFrame);
-		$(renderer, drawTexture, this->texture, &frame);
+		$(renderer, setDrawColor, &Colors.White);
 	}
 }
 
@@ -108,9 +104,9 @@ static void renderDeviceDidReset(View *self) {
 
 	Text *this = (Text *) self;
 
-	this->texture = 0;
-
-	$(this->font, renderDeviceDidReset);
+	if (this->font->isCached == false) {
+		$(this->font, renderDeviceDidReset);
+	}
 }
 
 /**
@@ -169,12 +165,8 @@ static void setFont(Text *self, Font *font) {
 		release(self->font);
 		self->font = retain(font);
 
-		if (self->texture) {
-			glDeleteTextures(1, &self->texture);
-			self->texture = 0;
-		}
-
 		$((View *) self, sizeToFit);
+		$((View *) self, setNeedsDisplay);
 	}
 }
 
@@ -192,12 +184,8 @@ static void setText(Text *self, const char *text) {
 		self->text = NULL;
 	}
 
-	if (self->texture) {
-		glDeleteTextures(1, &self->texture);
-		self->texture = 0;
-	}
-
 	$((View *) self, sizeToFit);
+	$((View *) self, setNeedsDisplay);
 }
 
 #pragma mark - Class lifecycle
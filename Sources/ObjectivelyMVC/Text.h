@@ -69,12 +69,6 @@ struct Text {
 	 * @see Text::setText(Text *, const char *)
 	 */
 	char *text;
-
-	/**
-	 * @brief The rendered texture.
-	 * @protected
-	 */
-	GLuint texture;
 };
 
 /**
@@ -106,14 +106,10 @@ static void render(View *self, Renderer *renderer) {
 		text = text ?: "";
 
 		int w, h;
-		if (this->position == this->attributedText->string.length) {
-			$(this->text->font, sizeCharacters, text, &w, &h);
-		} else {
-			char *chars = calloc(this->position + 1, sizeof(char));
-			strncpy(chars, text, this->position);
+		$(this->text->font, sizeCharacters, text, &w, &h);
 
-			$(this->text->font, sizeCharacters, chars, &w, &h);
-			free(chars);
+		if (this->position < this->attributedText->string.length) {
+			w = $(this->text->font, widthOfPrefix, text, this->position);
 		}
 
 		SDL_Rect frame = $((View *) this->text, renderFrame);
@@ -283,6 +279,13 @@ static _Bool captureEvent(Control *self, const SDL_Event *event) {
 	return didCaptureEvent;
 }
 
+/**
+ * @see Control::captureEventMask(const Control *)
+ */
+static int captureEventMask(const Control *self) {
+	return ViewEventMaskMouse | ViewEventMaskKeyboard | ViewEventMaskTextInput;
+}
+
 #pragma mark - TextView
 
 /**
@@ -333,6 +336,7 @@ static void initialize(Class *clazz) {
 	((ViewInterface *) clazz->def->interface)->render = render;
 
 	((ControlInterface *) clazz->def->interface)->captureEvent = captureEvent;
+	((ControlInterface *) clazz->def->interface)->captureEventMask = captureEventMask;
 
 	((TextViewInterface *) clazz->def->interface)->initWithFrame = initWithFrame;
 }
@@ -89,14 +89,14 @@ static void bindFloat(const Inlet *inlet, ident obj) {
  * @brief InletBinding for InletTypeFont.
  */
 static void bindFont(const Inlet *inlet, ident obj) {
-	*((Font **) inlet->dest) = $(alloc(Font), initWithName, cast(String, obj)->chars);
+	*((Font **) inlet->dest) = $$(Font, cachedFontWithName, cast(String, obj)->chars);
 }
 
 /**
  * @brief InletBinding for InletTypeImage.
  */
 static void bindImage(const Inlet *inlet, ident obj) {
-	*((Image **) inlet->dest) = $(alloc(Image), initWithName, cast(String, obj)->chars);
+	*((Image **) inlet->dest) = $$(Image, cachedImageWithName, cast(String, obj)->chars);
 }
 
 /**
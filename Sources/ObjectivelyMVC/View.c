@@ -51,8 +51,92 @@ const EnumName ViewAutoresizingNames[] = MakeEnumNames(
 
 static View *_firstResponder;
 
+static unsigned int _frameGeneration = 1;
+
+static unsigned int _eventRoute;
+static const SDL_Event *_routedEvent;
+static SDL_Point _lastPointerPoint;
+static MutableArray *_pointerGrab;
+
+static ViewEventStatistics _eventStatistics;
+
+/**
+ * @brief The state of the current View::draw pass.
+ */
+static struct {
+
+	/**
+	 * @brief The nesting level of View::draw within this pass.
+	 */
+	int level;
+
+	/**
+	 * @brief The depth of the View being drawn, from which its subviews' depths are derived.
+	 */
+	int depth;
+
+	/**
+	 * @brief The window frame, resolved once per pass, or empty if there is no window.
+	 */
+	SDL_Rect windowFrame;
+} _drawPass;
+
+static void invalidateEventMask(View *view);
+static void respondToEvent(View *self, const SDL_Event *event);
+
 static __thread Outlet *_outlets;
 
+#define VIEW_HIT_INDEX_CELL_SIZE 64
+
+/**
+ * @brief A View and its clipping frame, as indexed for hit testing.
+ */
+typedef struct {
+	View *view;
+	SDL_Rect frame;
+	int depth;
+} ViewHitEntry;
+
+/**
+ * @brief A uniform grid over the clipping frames of a View hierarchy.
+ * @details Each cell lists the entries whose clipping frames intersect it. The cells are stored
+ * contiguously, with `offsets` delimiting the entries of each cell.
+ */
+struct ViewHitIndex {
+
+	/**
+	 * @brief The frame generation for which this index is valid.
+	 */
+	unsigned int generation;
+
+	/**
+	 * @brief The area covered by the grid, in window coordinates.
+	 */
+	SDL_Rect area;
+
+	/**
+	 * @brief The grid dimensions, in cells.
+	 */
+	int cols, rows;
+
+	/**
+	 * @brief The entries, in hierarchy order.
+	 */
+	ViewHitEntry *entries;
+	size_t count, capacity;
+
+	/**
+	 * @brief The entry indexes of all cells.
+	 */
+	size_t *cells;
+	size_t numCells;
+
+	/**
+	 * @brief The offsets into `cells` for each cell, plus one.
+	 */
+	size_t *offsets;
+};
+
 #define _Class _View
 
 #pragma mark - ObjectInterface
@@ -66,6 +150,17 @@ static void dealloc(Object *self) {
 
 	free(this->identifier);
 
+	if (this->rasterTexture) {
+		glDeleteTextures(1, &this->rasterTexture);
+	}
+
+	if (this->hitIndex) {
+		free(this->hitIndex->entries);
+		free(this->hitIndex->cells);
+		free(this->hitIndex->offsets);
+		free(this->hitIndex);
+	}
+
 	$(this, removeFromSuperview);
 
 	release(this->subviews);
@@ -122,7 +217,15 @@ static void addSubviewRelativeTo(View *self, View *subview, View *other, ViewPos
 			$(self->subviews, addObject, subview);
 		}
 
-		self->needsLayout = true;
+		$(self, setNeedsLayout);
+
+		if (subview->needsLayout || subview->descendantsNeedLayout) {
+			self->descendantsNeedLayout = true;
+		}
+
+		invalidateEventMask(self);
+
+		$(subview, invalidateFrames);
 	}
 }
 
@@ -142,12 +245,15 @@ static void awakeWithDictionary(View *self, const Dictionary *dictionary) {
 		MakeInlet("frame", InletTypeRectangle, &self->frame, NULL),
 		MakeInlet("hidden", InletTypeBool, &self->hidden, NULL),
 		MakeInlet("padding", InletTypeRectangle, &self->padding, NULL),
+		MakeInlet("rasterizes", InletTypeBool, &self->rasterizes, NULL),
 		MakeInlet("subviews", InletTypeSubviews, &self, NULL),
 		MakeInlet("zIndex", InletTypeInteger, &self->zIndex, NULL)
 	);
 
 	$(self, bind, dictionary, inlets);
 
+	$(self, invalidateFrames);
+
 	if (self->identifier) {
 		for (Outlet *outlet = _outlets; outlet->identifier; outlet++) {
 			if (strcmp(outlet->identifier, self->identifier) == 0) {
@@ -202,46 +308,75 @@ static SDL_Rect bounds(const View *self) {
 }
 
 /**
- * @fn SDL_Rect View::clippingFrame(const View *self)
- * @memberof View
+ * @brief Resolves the frame cache of the given View, and of its ancestors, if necessary.
+ * @return The frame cache.
  */
-static SDL_Rect clippingFrame(const View *self) {
-
-	SDL_Rect frame = $(self, renderFrame);
+static const ViewFrameCache *resolveFrameCache(const View *self) {
 
-	if (self->borderWidth && self->borderColor.a) {
-		for (int i = 0; i < self->borderWidth; i++) {
-			frame.x -= 1;
-			frame.y -= 1;
-			frame.w += 2;
-			frame.h += 2;
-		}
+	ViewFrameCache *cache = (ViewFrameCache *) &self->frameCache;
+	if (cache->generation == _frameGeneration) {
+		return cache;
 	}
 
 	const View *superview = self->superview;
-	while (superview) {
-		if (superview->clipsSubviews) {
-			const SDL_Rect clippingFrame = $(superview, clippingFrame);
-			if (SDL_IntersectRect(&clippingFrame, &frame, &frame) == false) {
+	const ViewFrameCache *superCache = superview ? resolveFrameCache(superview) : NULL;
 
-				if (MVC_LogEnabled(SDL_LOG_PRIORITY_VERBOSE)) {
-					String *desc = $((Object *) self, description);
-					String *superdesc = $((Object *) superview, description);
+	SDL_Rect frame = self->frame;
 
-					MVC_LogVerbose("%s is clipped by %s\n", desc->chars, superdesc->chars);
+	if (superview) {
+		frame.x += superCache->renderFrame.x;
+		frame.y += superCache->renderFrame.y;
 
-					release(desc);
-					release(superdesc);
-				}
+		if (self->alignment != ViewAlignmentInternal) {
+			frame.x += superview->padding.left;
+			frame.y += superview->padding.top;
+		}
+	}
 
-				frame.w = frame.h = 0;
-				break;
+	cache->renderFrame = frame;
+
+	if (self->borderWidth && self->borderColor.a) {
+		frame.x -= self->borderWidth;
+		frame.y -= self->borderWidth;
+		frame.w += self->borderWidth * 2;
+		frame.h += self->borderWidth * 2;
+	}
+
+	if (superCache && superCache->clipsSubviews) {
+		if (SDL_IntersectRect(&superCache->subviewClippingFrame, &frame, &frame) == false) {
+
+			if (MVC_LogEnabled(SDL_LOG_PRIORITY_VERBOSE)) {
+				String *desc = $((Object *) self, description);
+				MVC_LogVerbose("%s is clipped by its ancestors\n", desc->chars);
+				release(desc);
 			}
+
+			frame.w = frame.h = 0;
 		}
-		superview = superview->superview;
 	}
 
-	return frame;
+	cache->clippingFrame = frame;
+
+	if (self->clipsSubviews) {
+		cache->clipsSubviews = true;
+		cache->subviewClippingFrame = frame;
+	} else if (superCache) {
+		cache->clipsSubviews = superCache->clipsSubviews;
+		cache->subviewClippingFrame = superCache->subviewClippingFrame;
+	} else {
+		cache->clipsSubviews = false;
+	}
+
+	cache->generation = _frameGeneration;
+	return cache;
+}
+
+/**
+ * @fn SDL_Rect View::clippingFrame(const View *self)
+ * @memberof View
+ */
+static SDL_Rect clippingFrame(const View *self) {
+	return resolveFrameCache(self)->clippingFrame;
 }
 
 /**
@@ -325,6 +460,70 @@ static _Bool didReceiveEvent(const View *self, const SDL_Event *event) {
 	return false;
 }
 
+/**
+ * @brief Resolves the union of the clipping frames of the given View and its visible descendants.
+ * @return The subtree frame, which is empty if nothing in the subtree can be seen.
+ * @remarks Descendants of a View which `clipsSubviews` can not escape its clipping frame, and so
+ * are not visited.
+ */
+static SDL_Rect resolveSubtreeFrame(const View *self) {
+
+	ViewFrameCache *cache = (ViewFrameCache *) resolveFrameCache(self);
+	if (cache->subtreeGeneration == _frameGeneration) {
+		return cache->subtreeFrame;
+	}
+
+	SDL_Rect frame = cache->clippingFrame;
+
+	if (self->clipsSubviews == false) {
+
+		const Array *subviews = (Array *) self->subviews;
+		for (size_t i = 0; i < subviews->count; i++) {
+
+			const View *subview = $(subviews, objectAtIndex, i);
+			if (subview->hidden) {
+				continue;
+			}
+
+			const SDL_Rect subtreeFrame = resolveSubtreeFrame(subview);
+			if (SDL_RectEmpty(&subtreeFrame)) {
+				continue;
+			}
+
+			if (SDL_RectEmpty(&frame)) {
+				frame = subtreeFrame;
+			} else {
+				SDL_UnionRect(&frame, &subtreeFrame, &frame);
+			}
+		}
+	}
+
+	cache->subtreeFrame = frame;
+	cache->subtreeGeneration = _frameGeneration;
+
+	return frame;
+}
+
+/**
+ * @param windowFrame The window frame, or an empty rectangle to skip the window test.
+ * @return True if the given View and its descendants can not be seen, and need not be drawn.
+ */
+static _Bool isCulled(const View *self, const SDL_Rect *windowFrame) {
+
+	const SDL_Rect subtreeFrame = resolveSubtreeFrame(self);
+	if (SDL_RectEmpty(&subtreeFrame)) {
+		return true;
+	}
+
+	if (SDL_RectEmpty(windowFrame) == false) {
+		if (SDL_HasIntersection(&subtreeFrame, windowFrame) == false) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 /**
  * @brief ArrayEnumerator for draw recursion.
  */
@@ -340,12 +539,52 @@ static void draw(View *self, Renderer *renderer) {
 
 	assert(renderer);
 
+	if (_drawPass.level == 0) {
+		_drawPass.depth = self->superview ? $(self->superview, depth) : -1;
+		_drawPass.windowFrame = MakeRect(0, 0, 0, 0);
+
+		SDL_Window *window = $(self, window);
+		if (window) {
+			SDL_GetWindowSize(window, &_drawPass.windowFrame.w, &_drawPass.windowFrame.h);
+		}
+	}
+
+	const int superviewDepth = _drawPass.depth;
+
+	_drawPass.depth = superviewDepth + 1 + self->zIndex;
+	_drawPass.level++;
+
 	if (self->hidden == false) {
 
-		$(renderer, addView, self);
+		if (isCulled(self, &_drawPass.windowFrame)) {
+			if (self->rasterizes && (self->needsDisplay || self->descendantsNeedDisplay)) {
+				self->rasterFrame = MakeRect(0, 0, 0, 0);
+			}
+		} else {
+			$(renderer, addView, self, _drawPass.depth);
 
-		$((Array *) self->subviews, enumerateObjects, draw_recurse, renderer);
+			if (self->rasterizes) {
+				if (self->needsDisplay || self->descendantsNeedDisplay) {
+					self->rasterFrame = MakeRect(0, 0, 0, 0);
+				}
+			} else {
+				$((Array *) self->subviews, enumerateObjects, draw_recurse, renderer);
+			}
+		}
 	}
+
+	_drawPass.level--;
+	_drawPass.depth = superviewDepth;
+
+	self->needsDisplay = self->descendantsNeedDisplay = false;
+}
+
+/**
+ * @fn ViewEventStatistics View::eventStatistics(void)
+ * @memberof View
+ */
+static ViewEventStatistics eventStatistics(void) {
+	return _eventStatistics;
 }
 
 /**
@@ -356,6 +595,200 @@ static View *firstResponder(void) {
 	return _firstResponder;
 }
 
+/**
+ * @brief Appends the visible Views of the given hierarchy to the hit index.
+ * @return True if any entry differs from that of the previous build.
+ */
+static _Bool hitIndex_collect(struct ViewHitIndex *index, View *view, int depth, size_t previousCount) {
+
+	_Bool changed = false;
+
+	if (view->hidden == false) {
+
+		const SDL_Rect frame = $(view, clippingFrame);
+		if (frame.w && frame.h) {
+
+			if (index->count == index->capacity) {
+				index->capacity = max(index->capacity * 2, 0x100);
+				index->entries = realloc(index->entries, index->capacity * sizeof(ViewHitEntry));
+				assert(index->entries);
+			}
+
+			ViewHitEntry *entry = &index->entries[index->count];
+			if (index->count >= previousCount
+				|| entry->view != view
+				|| entry->depth != depth
+				|| SDL_RectEquals(&entry->frame, &frame) == false) {
+
+				entry->view = view;
+				entry->frame = frame;
+				entry->depth = depth;
+
+				changed = true;
+			}
+
+			index->count++;
+		}
+
+		const Array *subviews = (Array *) view->subviews;
+		for (size_t i = 0; i < subviews->count; i++) {
+
+			View *subview = $(subviews, objectAtIndex, i);
+			changed |= hitIndex_collect(index, subview, depth + subview->zIndex + 1, previousCount);
+		}
+	}
+
+	return changed;
+}
+
+/**
+ * @brief Buckets the entries of the hit index into its grid cells.
+ */
+static void hitIndex_bucket(struct ViewHitIndex *index) {
+
+	const int size = VIEW_HIT_INDEX_CELL_SIZE;
+
+	index->cols = max((index->area.w + size - 1) / size, 1);
+	index->rows = max((index->area.h + size - 1) / size, 1);
+
+	const size_t numCells = index->cols * index->rows;
+
+	index->offsets = realloc(index->offsets, (numCells + 1) * sizeof(size_t));
+	assert(index->offsets);
+
+	memset(index->offsets, 0, (numCells + 1) * sizeof(size_t));
+
+	for (int pass = 0; pass < 2; pass++) {
+
+		for (size_t i = 0; i < index->count; i++) {
+
+			SDL_Rect frame;
+			if (SDL_IntersectRect(&index->entries[i].frame, &index->area, &frame) == false) {
+				continue;
+			}
+
+			const int c0 = (frame.x - index->area.x) / size, c1 = (frame.x + frame.w - 1 - index->area.x) / size;
+			const int r0 = (frame.y - index->area.y) / size, r1 = (frame.y + frame.h - 1 - index->area.y) / size;
+
+			for (int r = r0; r <= r1; r++) {
+				for (int c = c0; c <= c1; c++) {
+					if (pass == 0) {
+						index->offsets[r * index->cols + c + 1]++;
+					} else {
+						index->cells[index->offsets[r * index->cols + c]++] = i;
+					}
+				}
+			}
+		}
+
+		if (pass == 0) {
+			for (size_t i = 0; i < numCells; i++) {
+				index->offsets[i + 1] += index->offsets[i];
+			}
+
+			if (index->offsets[numCells] > index->numCells) {
+				index->numCells = index->offsets[numCells];
+				index->cells = realloc(index->cells, index->numCells * sizeof(size_t));
+				assert(index->cells);
+			}
+		} else {
+			for (size_t i = numCells; i > 0; i--) {
+				index->offsets[i] = index->offsets[i - 1];
+			}
+			index->offsets[0] = 0;
+		}
+	}
+}
+
+/**
+ * @brief Resolves the hit index of the given root View, rebuilding it if frames have changed.
+ * @remarks The grid cells are only rebuilt if a clipping frame, or the hierarchy, has changed.
+ */
+static struct ViewHitIndex *hitIndex(View *root) {
+
+	assert(root->superview == NULL);
+
+	if (root->hitIndex == NULL) {
+		root->hitIndex = calloc(1, sizeof(struct ViewHitIndex));
+		assert(root->hitIndex);
+	}
+
+	struct ViewHitIndex *index = root->hitIndex;
+	if (index->generation != _frameGeneration) {
+
+		const size_t previousCount = index->count;
+		index->count = 0;
+
+		const SDL_Rect area = $(root, clippingFrame);
+
+		if (hitIndex_collect(index, root, root->zIndex, previousCount)
+			|| index->count != previousCount
+			|| SDL_RectEquals(&area, &index->area) == false
+			|| index->offsets == NULL) {
+
+			index->area = area;
+			hitIndex_bucket(index);
+		}
+
+		index->generation = _frameGeneration;
+	}
+
+	return index;
+}
+
+/**
+ * @brief Returns the offset of the grid cell containing the given point, or `-1`.
+ */
+static ssize_t hitIndex_cell(const struct ViewHitIndex *index, const SDL_Point *point) {
+
+	if (SDL_PointInRect(point, &index->area)) {
+
+		const int c = (point->x - index->area.x) / VIEW_HIT_INDEX_CELL_SIZE;
+		const int r = (point->y - index->area.y) / VIEW_HIT_INDEX_CELL_SIZE;
+
+		return r * index->cols + c;
+	}
+
+	return -1;
+}
+
+/**
+ * @fn View *View::hitTest(const View *self, const SDL_Point *point)
+ * @memberof View
+ */
+static View *hitTest(const View *self, const SDL_Point *point) {
+
+	assert(point);
+
+	View *root = (View *) self;
+	while (root->superview) {
+		root = root->superview;
+	}
+
+	const struct ViewHitIndex *index = hitIndex(root);
+
+	const ssize_t cell = hitIndex_cell(index, point);
+	if (cell == -1) {
+		return NULL;
+	}
+
+	const ViewHitEntry *hit = NULL;
+
+	for (size_t i = index->offsets[cell]; i < index->offsets[cell + 1]; i++) {
+
+		const ViewHitEntry *entry = &index->entries[index->cells[i]];
+		if (hit && entry->depth < hit->depth) {
+			continue;
+		}
+
+		if (SDL_PointInRect(point, &entry->frame) && $(entry->view, isDescendantOfView, self)) {
+			hit = entry;
+		}
+	}
+
+	return hit ? hit->view : NULL;
+}
+
 /**
  * @fn View *View::init(View *self)
  * @memberof View
@@ -382,11 +815,66 @@ static View *initWithFrame(View *self, const SDL_Rect *frame) {
 
 		self->backgroundColor = Colors.Clear;
 		self->borderColor = Colors.White;
+
+		self->needsDisplay = true;
+
+		if (self->interface->respondToEvent == respondToEvent) {
+			self->eventMask = ViewEventMaskNone;
+		} else {
+			self->eventMask = ViewEventMaskAll;
+		}
+
+		self->subtreeEventMask = -1;
 	}
 
 	return self;
 }
 
+/**
+ * @brief Invalidates the cached frames of the given View and its descendants.
+ * @remarks A View's frames are always resolved after those of its ancestors, so the descendants
+ * of a View whose frames are not cached have none cached either, and need not be visited. The
+ * hit index of a View is invalidated too, as the View may since have been removed from its
+ * superview.
+ */
+static void invalidateFrames_recurse(View *self) {
+
+	if (self->hitIndex) {
+		self->hitIndex->generation = 0;
+	}
+
+	ViewFrameCache *cache = &self->frameCache;
+	if (cache->generation != _frameGeneration) {
+		return;
+	}
+
+	cache->generation = cache->subtreeGeneration = 0;
+
+	const Array *subviews = (Array *) self->subviews;
+	for (size_t i = 0; i < subviews->count; i++) {
+		invalidateFrames_recurse($(subviews, objectAtIndex, i));
+	}
+}
+
+/**
+ * @fn void View::invalidateFrames(View *self)
+ * @memberof View
+ */
+static void invalidateFrames(View *self) {
+
+	invalidateFrames_recurse(self);
+
+	View *view = self;
+	while (view->superview) {
+		view = view->superview;
+		view->frameCache.subtreeGeneration = 0;
+	}
+
+	if (view->hitIndex) {
+		view->hitIndex->generation = 0;
+	}
+}
+
 /**
  * @fn _Bool View::isDescendantOfView(const View *self, const View *view)
  * @memberof View
@@ -443,10 +931,16 @@ static void layoutIfNeeded(View *self) {
 		self->needsLayout = false;
 
 		$(self, layoutSubviews);
+
+		$(self, invalidateFrames);
 	}
 
-	const Array *subviews = (Array *) self->subviews;
-	$(subviews, enumerateObjects, layoutIfNeeded_recurse, NULL);
+	if (self->descendantsNeedLayout) {
+		self->descendantsNeedLayout = false;
+
+		const Array *subviews = (Array *) self->subviews;
+		$(subviews, enumerateObjects, layoutIfNeeded_recurse, NULL);
+	}
 }
 
 /**
@@ -546,11 +1040,16 @@ static void removeSubview(View *self, View *subview) {
 	assert(subview);
 
 	if (subview->superview == self) {
+
+		$(subview, invalidateFrames);
+
 		subview->superview = NULL;
 
 		$(self->subviews, removeObject, subview);
 
-		self->needsLayout = true;
+		$(self, setNeedsLayout);
+
+		invalidateEventMask(self);
 	}
 }
 
@@ -597,6 +1096,10 @@ static void renderDeviceDidReset_recurse(const Array *array, ident obj, ident da
  * @memberof View
  */
 static void renderDeviceDidReset(View *self) {
+
+	self->rasterTexture = 0;
+	self->rasterFrame = MakeRect(0, 0, 0, 0);
+
 	$((Array *) self->subviews, enumerateObjects, renderDeviceDidReset_recurse, NULL);
 }
 
@@ -605,26 +1108,7 @@ static void renderDeviceDidReset(View *self) {
  * @memberof View
  */
 static SDL_Rect renderFrame(const View *self) {
-
-	SDL_Rect frame = self->frame;
-
-	const View *view = self;
-	const View *superview = view->superview;
-	while (superview) {
-
-		frame.x += superview->frame.x;
-		frame.y += superview->frame.y;
-
-		if (view->alignment != ViewAlignmentInternal) {
-			frame.x += superview->padding.left;
-			frame.y += superview->padding.top;
-		}
-
-		view = superview;
-		superview = view->superview;
-	}
-
-	return frame;
+	return resolveFrameCache(self)->renderFrame;
 }
 
 /**
@@ -675,17 +1159,156 @@ static void resize(View *self, const SDL_Size *size) {
 		self->frame.w = size->w;
 		self->frame.h = size->h;
 
-		self->needsLayout = true;
+		$(self, setNeedsLayout);
+
+		$(self, invalidateFrames);
 
 //		$((Array *) self->subviews, enumerateObjects, resize_recurse, NULL);
 	}
 }
 
+/**
+ * @brief Marks the given View, and its ancestors, as recipients of the current pointer event.
+ */
+static void routeEvent_view(View *view) {
+
+	for (; view && view->eventRoute != _eventRoute; view = view->superview) {
+		view->eventRoute = _eventRoute;
+	}
+}
+
+/**
+ * @brief Marks the Views at the given point as recipients of the current pointer event.
+ */
+static void routeEvent_point(const struct ViewHitIndex *index, const SDL_Point *point) {
+
+	const ssize_t cell = hitIndex_cell(index, point);
+	if (cell > -1) {
+
+		for (size_t i = index->offsets[cell]; i < index->offsets[cell + 1]; i++) {
+
+			const ViewHitEntry *entry = &index->entries[index->cells[i]];
+			if (SDL_PointInRect(point, &entry->frame)) {
+				routeEvent_view(entry->view);
+			}
+		}
+	}
+}
+
+/**
+ * @brief ArrayEnumerator for marking the Views of the pointer grab.
+ */
+static void routeEvent_grab(const Array *array, ident obj, ident data) {
+	routeEvent_view((View *) obj);
+}
+
+/**
+ * @brief Selects the recipients of the given pointer event, beneath the given root View.
+ * @remarks The Views at the previous pointer location are included so that they may respond
+ * to the pointer leaving them. While a mouse button is held, the Views at which it was pressed
+ * are included so that they may respond to dragging.
+ */
+static void routeEvent(View *root, const SDL_Event *event) {
+
+	const struct ViewHitIndex *index = hitIndex(root);
+
+	if (++_eventRoute == 0) {
+		_eventRoute = 1;
+	}
+
+	SDL_Point point;
+	if (event->type == SDL_MOUSEMOTION) {
+		point = MakePoint(event->motion.x, event->motion.y);
+	} else {
+		SDL_GetMouseState(&point.x, &point.y);
+	}
+
+	routeEvent_point(index, &point);
+	routeEvent_point(index, &_lastPointerPoint);
+
+	_lastPointerPoint = point;
+
+	if (_pointerGrab && event->type == SDL_MOUSEMOTION && event->motion.state) {
+		$((Array *) _pointerGrab, enumerateObjects, routeEvent_grab, NULL);
+	}
+
+	if (_firstResponder) {
+		routeEvent_view(_firstResponder);
+	}
+}
+
+/**
+ * @brief Establishes the pointer grab, retaining the Views at the given point.
+ */
+static void grabPointer(View *root, const SDL_Point *point) {
+
+	release(_pointerGrab);
+	_pointerGrab = $$(MutableArray, array);
+
+	const struct ViewHitIndex *index = hitIndex(root);
+
+	const ssize_t cell = hitIndex_cell(index, point);
+	if (cell > -1) {
+
+		for (size_t i = index->offsets[cell]; i < index->offsets[cell + 1]; i++) {
+
+			const ViewHitEntry *entry = &index->entries[index->cells[i]];
+			if (SDL_PointInRect(point, &entry->frame)) {
+				$(_pointerGrab, addObject, entry->view);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Invalidates the aggregated event mask of the given View and its ancestors.
+ */
+static void invalidateEventMask(View *view) {
+
+	for (; view && view->subtreeEventMask != -1; view = view->superview) {
+		view->subtreeEventMask = -1;
+	}
+}
+
+/**
+ * @return The union of the event masks of the given View and its descendants.
+ */
+static int subtreeEventMask(View *view) {
+
+	if (view->subtreeEventMask == -1) {
+
+		int mask = view->eventMask;
+
+		const Array *subviews = (Array *) view->subviews;
+		for (size_t i = 0; i < subviews->count; i++) {
+			mask |= subtreeEventMask($(subviews, objectAtIndex, i));
+		}
+
+		view->subtreeEventMask = mask;
+	}
+
+	return view->subtreeEventMask;
+}
+
 /**
  * @brief ArrayEnumerator for respondToEvent recursion.
  */
 static void respondToEvent_recurse(const Array *array, ident obj, ident data) {
-	$((View *) obj, respondToEvent, (const SDL_Event *) data);
+
+	View *view = (View *) obj;
+
+	const SDL_Event *event = (const SDL_Event *) data;
+
+	if (event == _routedEvent && view->eventRoute != _eventRoute) {
+		return;
+	}
+
+	if ((subtreeEventMask(view) & MVC_EventMask(event->type)) == 0) {
+		_eventStatistics.pruned++;
+		return;
+	}
+
+	$(view, respondToEvent, event);
 }
 
 /**
@@ -696,6 +1319,14 @@ static void respondToEvent(View *self, const SDL_Event *event) {
 
 	assert(event);
 
+	if (self->superview == NULL) {
+		_eventStatistics.events++;
+		_eventStatistics.lastVisits = 0;
+	}
+
+	_eventStatistics.visits++;
+	_eventStatistics.lastVisits++;
+
 	if (self->superview == NULL) {
 		if (event->type == SDL_WINDOWEVENT) {
 			if (event->window.event == SDL_WINDOWEVENT_SHOWN
@@ -710,9 +1341,72 @@ static void respondToEvent(View *self, const SDL_Event *event) {
 				}
 			}
 		}
+
+		if (event->type == SDL_MOUSEMOTION || event->type == SDL_MOUSEWHEEL) {
+
+			routeEvent(self, event);
+
+			const SDL_Event *routedEvent = _routedEvent;
+			_routedEvent = event;
+
+			$((Array *) self->subviews, enumerateObjects, respondToEvent_recurse, (ident) event);
+
+			_routedEvent = routedEvent;
+			return;
+		}
+
+		if (event->type == SDL_MOUSEBUTTONDOWN) {
+			const SDL_Point point = { .x = event->button.x, .y = event->button.y };
+			grabPointer(self, &point);
+		}
 	}
 
 	$((Array *) self->subviews, enumerateObjects, respondToEvent_recurse, (ident) event);
+
+	if (self->superview == NULL && event->type == SDL_MOUSEBUTTONUP) {
+		release(_pointerGrab);
+		_pointerGrab = NULL;
+	}
+}
+
+/**
+ * @fn void View::setEventMask(View *self, int eventMask)
+ * @memberof View
+ */
+static void setEventMask(View *self, int eventMask) {
+
+	if (self->eventMask != eventMask) {
+		self->eventMask = eventMask;
+		invalidateEventMask(self);
+	}
+}
+
+/**
+ * @fn void View::setNeedsDisplay(View *self)
+ * @memberof View
+ */
+static void setNeedsDisplay(View *self) {
+
+	self->needsDisplay = true;
+
+	for (View *view = self->superview; view; view = view->superview) {
+		view->descendantsNeedDisplay = true;
+	}
+}
+
+/**
+ * @fn void View::setNeedsLayout(View *self)
+ * @memberof View
+ */
+static void setNeedsLayout(View *self) {
+
+	self->needsLayout = true;
+
+	$(self, setNeedsDisplay);
+
+	for (View *view = self->superview; view && view->descendantsNeedLayout == false; view = view->superview) {
+		view->descendantsNeedLayout = true;
+	}
 }
 
 /**
@@ -949,9 +1643,12 @@ static void initialize(Class *clazz) {
 	((ViewInterface *) clazz->def->interface)->depth = depth;
 	((ViewInterface *) clazz->def->interface)->didReceiveEvent = didReceiveEvent;
 	((ViewInterface *) clazz->def->interface)->draw = draw;
+	((ViewInterface *) clazz->def->interface)->eventStatistics = eventStatistics;
 	((ViewInterface *) clazz->def->interface)->firstResponder = firstResponder;
+	((ViewInterface *) clazz->def->interface)->hitTest = hitTest;
 	((ViewInterface *) clazz->def->interface)->init = init;
 	((ViewInterface *) clazz->def->interface)->initWithFrame = initWithFrame;
+	((ViewInterface *) clazz->def->interface)->invalidateFrames = invalidateFrames;
 	((ViewInterface *) clazz->def->interface)->isDescendantOfView = isDescendantOfView;
 	((ViewInterface *) clazz->def->interface)->isFirstResponder = isFirstResponder;
 	((ViewInterface *) clazz->def->interface)->isVisible = isVisible;
@@ -965,6 +1662,9 @@ static void initialize(Class *clazz) {
 	((ViewInterface *) clazz->def->interface)->resignFirstResponder = resignFirstResponder;
 	((ViewInterface *) clazz->def->interface)->resize = resize;
 	((ViewInterface *) clazz->def->interface)->respondToEvent = respondToEvent;
+	((ViewInterface *) clazz->def->interface)->setEventMask = setEventMask;
+	((ViewInterface *) clazz->def->interface)->setNeedsDisplay = setNeedsDisplay;
+	((ViewInterface *) clazz->def->interface)->setNeedsLayout = setNeedsLayout;
 	((ViewInterface *) clazz->def->interface)->size = size;
 	((ViewInterface *) clazz->def->interface)->sizeThatContains = sizeThatContains;
 	((ViewInterface *) clazz->def->interface)->sizeThatFits = sizeThatFits;
@@ -1001,6 +1701,13 @@ Class *_View(void) {
 
 #undef _Class
 
+void MVC_InvalidateFrames(void) {
+
+	if (++_frameGeneration == 0) {
+		_frameGeneration = 1;
+	}
+}
+
 SDL_Rect MVC_TransformToWindow(SDL_Window *window, const SDL_Rect *rect) {
 
 	assert(rect);
@@ -1020,6 +1727,58 @@ SDL_Rect MVC_TransformToWindow(SDL_Window *window, const SDL_Rect *rect) {
 	return transformed;
 }
 
+int MVC_EventMask(Uint32 type) {
+
+	switch (type) {
+		case SDL_KEYDOWN:
+		case SDL_KEYUP:
+			return ViewEventMaskKeyboard;
+
+		case SDL_TEXTEDITING:
+		case SDL_TEXTINPUT:
+			return ViewEventMaskTextInput;
+
+		case SDL_MOUSEMOTION:
+			return ViewEventMaskMouseMotion;
+
+		case SDL_MOUSEBUTTONDOWN:
+		case SDL_MOUSEBUTTONUP:
+			return ViewEventMaskMouseButton;
+
+		case SDL_MOUSEWHEEL:
+			return ViewEventMaskMouseWheel;
+
+		case SDL_JOYAXISMOTION:
+		case SDL_JOYBALLMOTION:
+		case SDL_JOYHATMOTION:
+		case SDL_JOYBUTTONDOWN:
+		case SDL_JOYBUTTONUP:
+		case SDL_JOYDEVICEADDED:
+		case SDL_JOYDEVICEREMOVED:
+		case SDL_CONTROLLERAXISMOTION:
+		case SDL_CONTROLLERBUTTONDOWN:
+		case SDL_CONTROLLERBUTTONUP:
+		case SDL_CONTROLLERDEVICEADDED:
+		case SDL_CONTROLLERDEVICEREMOVED:
+		case SDL_CONTROLLERDEVICEREMAPPED:
+			return ViewEventMaskJoystick;
+
+		case SDL_FINGERDOWN:
+		case SDL_FINGERUP:
+		case SDL_FINGERMOTION:
+		case SDL_DOLLARGESTURE:
+		case SDL_DOLLARRECORD:
+		case SDL_MULTIGESTURE:
+			return ViewEventMaskTouch;
+
+		case SDL_WINDOWEVENT:
+			return ViewEventMaskWindow;
+
+		default:
+			return ViewEventMaskOther;
+	}
+}
+
 double MVC_WindowScale(SDL_Window *window, int *height, int *drawableHeight) {
 
 	window = window ?: SDL_GL_GetCurrentWindow();
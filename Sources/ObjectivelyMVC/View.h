@@ -92,6 +92,93 @@ typedef enum {
 	ViewPositionAfter = 1
 } ViewPosition;
 
+/**
+ * @brief Event interest constants, which are bitmasked.
+ * @see MVC_EventMask(Uint32)
+ */
+typedef enum {
+	ViewEventMaskNone = 0,
+	ViewEventMaskKeyboard = 0x1,
+	ViewEventMaskTextInput = 0x2,
+	ViewEventMaskMouseMotion = 0x4,
+	ViewEventMaskMouseButton = 0x8,
+	ViewEventMaskMouseWheel = 0x10,
+	ViewEventMaskMouse = 0x1c,
+	ViewEventMaskJoystick = 0x20,
+	ViewEventMaskTouch = 0x40,
+	ViewEventMaskWindow = 0x80,
+	ViewEventMaskOther = 0x100,
+	ViewEventMaskAll = 0x1ff
+} ViewEventMask;
+
+/**
+ * @brief Event dispatch statistics.
+ */
+typedef struct {
+
+	/**
+	 * @brief The count of events dispatched to the View hierarchy.
+	 */
+	size_t events;
+
+	/**
+	 * @brief The count of Views which responded to those events.
+	 */
+	size_t visits;
+
+	/**
+	 * @brief The count of subtrees skipped because no View within them consumes the event type.
+	 */
+	size_t pruned;
+
+	/**
+	 * @brief The count of Views which responded to the most recent event.
+	 */
+	size_t lastVisits;
+} ViewEventStatistics;
+
+/**
+ * @brief Frames resolved in the View hierarchy, cached until frames are invalidated.
+ * @see View::invalidateFrames(View *)
+ */
+typedef struct {
+
+	/**
+	 * @brief The frame generation for which this cache is valid.
+	 */
+	unsigned int generation;
+
+	/**
+	 * @brief The cached render frame.
+	 */
+	SDL_Rect renderFrame;
+
+	/**
+	 * @brief The cached clipping frame.
+	 */
+	SDL_Rect clippingFrame;
+
+	/**
+	 * @brief True if subviews are clipped to `subviewClippingFrame`.
+	 */
+	_Bool clipsSubviews;
+
+	/**
+	 * @brief The frame to which subviews are clipped, by this View or its ancestors.
+	 */
+	SDL_Rect subviewClippingFrame;
+
+	/**
+	 * @brief The frame generation for which `subtreeFrame` is valid.
+	 */
+	unsigned int subtreeGeneration;
+
+	/**
+	 * @brief The union of the clipping frames of this View and its visible descendants.
+	 */
+	SDL_Rect subtreeFrame;
+} ViewFrameCache;
+
 typedef struct ViewInterface ViewInterface;
 
 /**
@@ -145,16 +232,51 @@ struct View {
 	 */
 	_Bool clipsSubviews;
 
+	/**
+	 * @brief The ViewEventMask of event types which this View consumes.
+	 * @remarks Events are only dispatched to subtrees in which at least one View consumes their
+	 * type. Views which override View::respondToEvent consume all events by default.
+	 * @see View::setEventMask(View *, int)
+	 */
+	int eventMask;
+
+	/**
+	 * @brief The route of the last pointer event for which this View was a recipient.
+	 * @private
+	 */
+	unsigned int eventRoute;
+
+	/**
+	 * @brief The union of the event masks of this View and its descendants, or `-1` if it must be
+	 * recomputed.
+	 * @private
+	 */
+	int subtreeEventMask;
+
 	/**
 	 * @brief The frame, relative to the superview.
+	 * @remarks Call View::invalidateFrames after assigning this directly.
 	 */
 	SDL_Rect frame;
 
+	/**
+	 * @brief The cached render and clipping frames.
+	 * @private
+	 */
+	ViewFrameCache frameCache;
+
 	/**
 	 * @brief If `true`, this View is not drawn.
+	 * @remarks Call View::invalidateFrames after assigning this directly.
 	 */
 	_Bool hidden;
 
+	/**
+	 * @brief The hit test index, for root Views.
+	 * @private
+	 */
+	struct ViewHitIndex *hitIndex;
+
 	/**
 	 * @brief An optional identifier.
 	 * @remarks Identifiers are commonly used to resolve Outlets when loading Views via JSON.
@@ -162,15 +284,57 @@ struct View {
 	char *identifier;
 
 	/**
-	 * @brief If true,
+	 * @brief If true, this View has changed since it was last drawn.
+	 * @remarks Do not set this property directly.
+	 * @see View::setNeedsDisplay(View *)
+	 */
+	_Bool needsDisplay;
+
+	/**
+	 * @brief If true, at least one descendant of this View has changed since it was last drawn.
+	 * @private
+	 */
+	_Bool descendantsNeedDisplay;
+
+	/**
+	 * @brief If true, this View will be laid out by the next call to View::layoutIfNeeded.
+	 * @remarks Do not set this property directly.
+	 * @see View::setNeedsLayout(View *)
 	 */
 	_Bool needsLayout;
 
+	/**
+	 * @brief If true, at least one descendant of this View needs layout.
+	 * @private
+	 */
+	_Bool descendantsNeedLayout;
+
 	/**
 	 * @brief The padding.
 	 */
 	ViewPadding padding;
 
+	/**
+	 * @brief If `true`, this View and its descendants are rendered once into a texture, which is
+	 * then drawn in their place until any of them changes.
+	 * @remarks This is useful for complex Views which rarely change, such as a Panel of Controls.
+	 * Descendants which change every frame defeat the cache, and should not be rasterized.
+	 */
+	_Bool rasterizes;
+
+	/**
+	 * @brief The region of this View held by `rasterTexture`, relative to its render frame, or
+	 * an empty rectangle if the rasterization must be redrawn.
+	 * @private
+	 */
+	SDL_Rect rasterFrame;
+
+	/**
+	 * @brief The cached rasterization of this View and its descendants, or `0`.
+	 * @private
+	 */
+	GLuint rasterTexture;
+
 	/**
 	 * @brief All contained views.
 	 */
@@ -264,7 +428,7 @@ struct ViewInterface {
 	 * @param self The View.
 	 * @return The visible portion of this View's frame, in window coordinates.
 	 * @remarks This is equivalent to the View's `renderFrame`, expanded for border width, and
-	 * clipped to all ancestors.
+	 * clipped to all ancestors. The result is cached until frames are invalidated.
 	 * @memberof View
 	 */
 	SDL_Rect (*clippingFrame)(const View *self);
@@ -311,11 +475,22 @@ struct ViewInterface {
 	 * @param renderer The Renderer with which to draw.
 	 * @remarks The default implementation of this method adds the View to the Renderer for the
 	 * current frame, and recurses its subviews. Rasterization is performed in View::render.
+	 * Subviews of a View which `rasterizes` are drawn by the Renderer, and only when its cached
+	 * texture must be redrawn. Views whose subtree is entirely clipped by their ancestors, or lies
+	 * outside of the window, are culled along with their descendants.
 	 * @see View::render(View *, Renderer *)
 	 * @memberof View
 	 */
 	void (*draw)(View *self, Renderer *renderer);
 
+	/**
+	 * @static
+	 * @fn ViewEventStatistics View::eventStatistics(void)
+	 * @return The event dispatch statistics.
+	 * @memberof View
+	 */
+	ViewEventStatistics (*eventStatistics)(void);
+
 	/**
 	 * @static
 	 * @fn View *View::firstResponder(void)
@@ -324,6 +499,18 @@ struct ViewInterface {
 	 */
 	View *(*firstResponder)(void);
 
+	/**
+	 * @fn View *View::hitTest(const View *self, const SDL_Point *point)
+	 * @brief Resolves the front-most visible View, within this View's hierarchy, at the given point.
+	 * @param self The View.
+	 * @param point A point in window coordinate space.
+	 * @return This View or its front-most descendant containing `point`, or `NULL`.
+	 * @remarks Hit testing is backed by a uniform grid over the clipping frames of the View
+	 * hierarchy, which is rebuilt lazily once frames have been invalidated.
+	 * @memberof View
+	 */
+	View *(*hitTest)(const View *self, const SDL_Point *point);
+
 	/**
 	 * @fn View *View::init(View *self)
 	 * @brief Initializes this View.
@@ -347,6 +534,18 @@ struct ViewInterface {
 	 */
 	View *(*initWithFrame)(View *self, const SDL_Rect *frame);
 
+	/**
+	 * @fn void View::invalidateFrames(View *self)
+	 * @brief Invalidates the cached frames of this View and its descendants.
+	 * @param self The View.
+	 * @remarks The cached subtree frames of this View's ancestors, and the hit index of its root,
+	 * are invalidated too. The methods of View and its subclasses call this for you. Call it after
+	 * assigning `frame`, `padding`, `hidden`, `borderWidth` or `clipsSubviews` directly, outside
+	 * of View::layoutSubviews.
+	 * @memberof View
+	 */
+	void (*invalidateFrames)(View *self);
+
 	/**
 	 * @fn _Bool View::isDescendantOfView(const View *self, const View *view)
 	 * @param self The View.
@@ -376,6 +575,7 @@ struct ViewInterface {
 	 * @fn void View::layoutIfNeeded(View *self)
 	 * @brief Recursively updates the layout of this View and its subviews.
 	 * @param self The View.
+	 * @remarks Subtrees in which no View needs layout are skipped.
 	 * @memberof View
 	 */
 	void (*layoutIfNeeded)(View *self);
@@ -430,6 +630,7 @@ struct ViewInterface {
 	 * @fn SDL_Frame View::renderFrame(const View *self)
 	 * @param self The View.
 	 * @return This View's absolute frame in the View hierarchy, in object space.
+	 * @remarks The result is cached until frames are invalidated.
 	 * @memberof View
 	 */
 	SDL_Rect (*renderFrame)(const View *self);
@@ -456,10 +657,44 @@ struct ViewInterface {
 	 * @brief Responds to the specified event.
 	 * @param self The View.
 	 * @param event The SDL_Event.
+	 * @remarks Mouse motion and wheel events are routed only to the Views at the pointer, the
+	 * Views at the previous pointer location, the Views at which a mouse button is held, and the
+	 * first responder, along with their ancestors. All other events are delivered to every View
+	 * whose subtree consumes their type, according to `eventMask`.
 	 * @memberof View
 	 */
 	void (*respondToEvent)(View *self, const SDL_Event *event);
 
+	/**
+	 * @fn void View::setEventMask(View *self, int eventMask)
+	 * @brief Sets the ViewEventMask of event types which this View consumes.
+	 * @param self The View.
+	 * @param eventMask The ViewEventMask.
+	 * @memberof View
+	 */
+	void (*setEventMask)(View *self, int eventMask);
+
+	/**
+	 * @fn void View::setNeedsDisplay(View *self)
+	 * @brief Marks this View as needing to be drawn, and the path to it from the root of the
+	 * View hierarchy as having changed descendants.
+	 * @param self The View.
+	 * @remarks Call this method after modifying any property which affects the appearance of this
+	 * View directly, e.g. `backgroundColor` or `hidden`. Setters and layout do so for you. Changes
+	 * to `hidden` also require View::invalidateFrames.
+	 * @see WindowController::needsRender(const WindowController *)
+	 * @memberof View
+	 */
+	void (*setNeedsDisplay)(View *self);
+
+	/**
+	 * @fn void View::setNeedsLayout(View *self)
+	 * @brief Marks this View, and the path to it from the root of the View hierarchy, as needing layout.
+	 * @param self The View.
+	 * @memberof View
+	 */
+	void (*setNeedsLayout)(View *self);
+
 	/**
 	 * @fn SDL_Size View::size(const View *self)
 	 * @param self The View.
@@ -576,6 +811,21 @@ struct ViewInterface {
 
 OBJECTIVELYMVC_EXPORT Class *_View(void);
 
+/**
+ * @brief Resolves the ViewEventMask for the specified event type.
+ * @param type The SDL_EventType.
+ * @return The ViewEventMask.
+ */
+OBJECTIVELYMVC_EXPORT int MVC_EventMask(Uint32 type);
+
+/**
+ * @brief Invalidates the cached render and clipping frames of all Views.
+ * @remarks Cached frames are resolved lazily, from the root of the View hierarchy down, the next
+ * time they are requested. Prefer View::invalidateFrames, which invalidates only the subtree that
+ * changed.
+ */
+OBJECTIVELYMVC_EXPORT void MVC_InvalidateFrames(void);
+
 /**
  * @brief Transforms the specified rectangle to normalized device coordinates in `window`.
  * @param window The window.
@@ -22,6 +22,7 @@
  */
 
 #include <assert.h>
+#include <string.h>
 
 #include <ObjectivelyMVC/Log.h>
 #include <ObjectivelyMVC/WindowController.h>
@@ -43,8 +44,131 @@ static void dealloc(Object *self) {
 	super(Object, self, dealloc);
 }
 
+#pragma mark - Event coalescing
+
+/**
+ * @brief Dispatches the given event to the ViewController.
+ */
+static void dispatchEvent(WindowController *self, const SDL_Event *event) {
+
+	if (event->type == SDL_WINDOWEVENT) {
+
+		if (self->viewController && self->viewController->view) {
+			$(self->viewController->view, setNeedsDisplay);
+		}
+
+		if (event->window.event == SDL_WINDOWEVENT_SHOWN) {
+
+			if (self->renderer) {
+				$(self->renderer, renderDeviceDidReset);
+			}
+
+			if (self->viewController) {
+				$(self->viewController, renderDeviceDidReset);
+			}
+		}
+	}
+
+	if (self->viewController) {
+		$(self->viewController, respondToEvent, event);
+	}
+}
+
+/**
+ * @brief Merges the given mouse motion event into the pending motion event.
+ * @return True if the event was merged, false if it must be dispatched on its own.
+ */
+static _Bool coalesceMotion(WindowController *self, const SDL_Event *event) {
+
+	SDL_MouseMotionEvent *pending = &self->pendingMotion.motion;
+
+	if (pending->type == SDL_MOUSEMOTION) {
+		if (pending->windowID != event->motion.windowID ||
+			pending->which != event->motion.which ||
+			pending->state != event->motion.state) {
+			return false;
+		}
+
+		const Sint32 xrel = pending->xrel + event->motion.xrel;
+		const Sint32 yrel = pending->yrel + event->motion.yrel;
+
+		*pending = event->motion;
+
+		pending->xrel = xrel;
+		pending->yrel = yrel;
+	} else {
+		self->pendingMotion = *event;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Merges the given mouse wheel event into the pending wheel event.
+ * @return True if the event was merged, false if it must be dispatched on its own.
+ */
+static _Bool coalesceWheel(WindowController *self, const SDL_Event *event) {
+
+	SDL_MouseWheelEvent *pending = &self->pendingWheel.wheel;
+
+	if (pending->type == SDL_MOUSEWHEEL) {
+		if (pending->windowID != event->wheel.windowID ||
+			pending->which != event->wheel.which) {
+			return false;
+		}
+
+		const Sint32 x = pending->x + event->wheel.x;
+		const Sint32 y = pending->y + event->wheel.y;
+
+		*pending = event->wheel;
+
+		pending->x = x;
+		pending->y = y;
+	} else {
+		self->pendingWheel = *event;
+	}
+
+	return true;
+}
+
 #pragma mark - WindowController
 
+/**
+ * @fn void WindowController::dispatchEvents(WindowController *self)
+ * @memberof WindowController
+ */
+static void dispatchEvents(WindowController *self) {
+
+	SDL_Event first, second;
+	memset(&first, 0, sizeof(first));
+	memset(&second, 0, sizeof(second));
+
+	if (self->pendingMotion.type && self->pendingWheel.type) {
+		if (self->pendingWheel.common.timestamp < self->pendingMotion.common.timestamp) {
+			first = self->pendingWheel;
+			second = self->pendingMotion;
+		} else {
+			first = self->pendingMotion;
+			second = self->pendingWheel;
+		}
+	} else if (self->pendingMotion.type) {
+		first = self->pendingMotion;
+	} else if (self->pendingWheel.type) {
+		first = self->pendingWheel;
+	}
+
+	memset(&self->pendingMotion, 0, sizeof(self->pendingMotion));
+	memset(&self->pendingWheel, 0, sizeof(self->pendingWheel));
+
+	if (first.type) {
+		dispatchEvent(self, &first);
+	}
+
+	if (second.type) {
+		dispatchEvent(self, &second);
+	}
+}
+
 /**
  * @fn WindowController *WindowController::initWithWindow(WindowController *self, SDL_Window *window)
  * @memberof WindowController
@@ -67,6 +191,27 @@ static WindowController *initWithWindow(WindowController *self, SDL_Window *wind
 	return self;
 }
 
+/**
+ * @fn _Bool WindowController::needsRender(const WindowController *self)
+ * @memberof WindowController
+ */
+static _Bool needsRender(const WindowController *self) {
+
+	if (self->pendingMotion.type || self->pendingWheel.type) {
+		return true;
+	}
+
+	if (self->viewController) {
+		const View *view = self->viewController->view;
+		if (view) {
+			return view->needsDisplay || view->descendantsNeedDisplay;
+		}
+		return true;
+	}
+
+	return false;
+}
+
 /**
  * @fn void WindowController::setRenderer(WindowController *self, Renderer *renderer)
  * @memberof WindowController
@@ -82,6 +227,10 @@ static void setRenderer(WindowController *self, Renderer *renderer) {
 		} else {
 			self->renderer = NULL;
 		}
+
+		if (self->viewController && self->viewController->view) {
+			$(self->viewController->view, setNeedsDisplay);
+		}
 	}
 }
 
@@ -103,6 +252,7 @@ static void setViewController(WindowController *self, ViewController *viewContro
 
 		if (self->viewController) {
 			$(self->viewController, loadViewIfNeeded);
+			$(self->viewController->view, setNeedsDisplay);
 		}
 	}
 }
@@ -115,11 +265,15 @@ static void render(WindowController *self) {
 
 	assert(self->renderer);
 
+	$(self, dispatchEvents);
+
 	$(self->renderer, beginFrame);
 
 	if (self->viewController) {
-		$(self->viewController, drawView, self->renderer);
-		$(self->renderer, render);
+		if ($(self, needsRender) || $(self->renderer, isCompositeValid) == false) {
+			$(self->viewController, drawView, self->renderer);
+			$(self->renderer, render);
+		}
 	} else {
 		MVC_LogWarn("viewController is NULL\n");
 	}
@@ -133,22 +287,28 @@ static void render(WindowController *self) {
  */
 static void respondToEvent(WindowController *self, const SDL_Event *event) {
 
-	if (event->type == SDL_WINDOWEVENT) {
-		if (event->window.event == SDL_WINDOWEVENT_SHOWN) {
+	if (self->coalescesEvents) {
 
-			if (self->renderer) {
-				$(self->renderer, renderDeviceDidReset);
-			}
+		_Bool (*coalesce)(WindowController *, const SDL_Event *) = NULL;
 
-			if (self->viewController) {
-				$(self->viewController, renderDeviceDidReset);
+		if (event->type == SDL_MOUSEMOTION) {
+			coalesce = coalesceMotion;
+		} else if (event->type == SDL_MOUSEWHEEL) {
+			coalesce = coalesceWheel;
+		}
+
+		if (coalesce) {
+			if (coalesce(self, event) == false) {
+				$(self, dispatchEvents);
+				coalesce(self, event);
 			}
+			return;
 		}
 	}
 
-	if (self->viewController) {
-		$(self->viewController, respondToEvent, event);
-	}
+	$(self, dispatchEvents);
+
+	dispatchEvent(self, event);
 }
 
 #pragma mark - Class lifecycle
@@ -160,7 +320,9 @@ static void initialize(Class *clazz) {
 
 	((ObjectInterface *) clazz->def->interface)->dealloc = dealloc;
 
+	((WindowControllerInterface *) clazz->def->interface)->dispatchEvents = dispatchEvents;
 	((WindowControllerInterface *) clazz->def->interface)->initWithWindow = initWithWindow;
+	((WindowControllerInterface *) clazz->def->interface)->needsRender = needsRender;
 	((WindowControllerInterface *) clazz->def->interface)->render = render;
 	((WindowControllerInterface *) clazz->def->interface)->respondToEvent = respondToEvent;
 	((WindowControllerInterface *) clazz->def->interface)->setRenderer = setRenderer;
@@ -53,6 +53,26 @@ struct WindowController {
 	 */
 	WindowControllerInterface *interface;
 
+	/**
+	 * @brief If true, consecutive mouse motion and wheel events are merged and dispatched
+	 * once per frame, rather than once per event.
+	 * @remarks Coalesced events are dispatched before any other event, and before rendering,
+	 * so their ordering relative to button and key events is preserved.
+	 */
+	_Bool coalescesEvents;
+
+	/**
+	 * @brief The pending mouse motion event, if coalescing.
+	 * @private
+	 */
+	SDL_Event pendingMotion;
+
+	/**
+	 * @brief The pending mouse wheel event, if coalescing.
+	 * @private
+	 */
+	SDL_Event pendingWheel;
+
 	/**
 	 * @brief The Renderer.
 	 */
@@ -79,6 +99,17 @@ struct WindowControllerInterface {
 	 */
 	ObjectInterface objectInterface;
 
+	/**
+	 * @fn void WindowController::dispatchEvents(WindowController *self)
+	 * @brief Dispatches any pending coalesced events to the ViewController.
+	 * @param self The WindowController.
+	 * @remarks This is called by WindowController::render, and before dispatching any event that
+	 * can not be coalesced. Applications rarely need to call it directly.
+	 * @see WindowController::coalescesEvents
+	 * @memberof WindowController
+	 */
+	void (*dispatchEvents)(WindowController *self);
+
 	/**
 	 * @fn WindowController *WindowController::initWithWindow(WindowController *self, SDL_Window *window)
 	 * @brief Initializes this WindowController with the given window.
@@ -107,11 +138,25 @@ struct WindowControllerInterface {
 	 */
 	void (*setViewController)(WindowController *self, ViewController *viewController);
 
+	/**
+	 * @fn _Bool WindowController::needsRender(const WindowController *self)
+	 * @brief Checks whether the View hierarchy has changed since it was last rendered.
+	 * @param self The WindowController.
+	 * @return True if the View hierarchy must be rendered to reflect its current state, or if
+	 * coalesced events are pending dispatch.
+	 * @remarks Applications which redraw the window only when necessary may skip their frame,
+	 * including WindowController::render, when this method returns false.
+	 * @see View::setNeedsDisplay(View *)
+	 * @memberof WindowController
+	 */
+	_Bool (*needsRender)(const WindowController *self);
+
 	/**
 	 * @fn void WindowController::render(WindowController *self)
 	 * @brief Renders the ViewController's View.
 	 * @param self The WindowController.
 	 * @remarks Your application should call this method once per frame to render the View hierarchy.
+	 * If the Renderer composites Views, and nothing has changed, the previous frame is reused.
 	 * @memberof WindowController
 	 */
 	void (*render)(WindowController *self);
@@ -121,6 +166,8 @@ struct WindowControllerInterface {
 	 * @brief Responds to the given event.
 	 * @param self The WindowController.
 	 * @param event The SDL_Event.
+	 * @remarks If this WindowController coalesces events, mouse motion and wheel events may be
+	 * deferred until WindowController::dispatchEvents.
 	 * @memberof WindowController
 	 */
 	void (*respondToEvent)(WindowController * self, const SDL_Event *event);